@@ -0,0 +1,94 @@
+// 시리얼 명령 PARAM 선택 + 값 변환 비용 비교 (host 전용)
+// - chain: strcmp를 키 순서대로 이어서 비교하고 atol()로 변환 (이전 main.cpp 방식)
+// - table: CommandTable 완전 해시로 처리 함수 하나를 고르고 commandParseUnsigned()로 변환 (include/command_table.h)
+// 키는 main.cpp와 같은 7개 (HIST, STATS, TRACE 포함), 명령마다 BENCH_REPEAT번 반복한 평균
+// bench/run_command_bench.sh 가 빌드하여 실행한다.
+// 출력: JSON 배열 (명령별 방식당 ns)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "command_table.h"
+
+#define BENCH_REPEAT 2000000
+
+static volatile unsigned long sink = 0; // 최적화로 처리 함수가 사라지지 않도록
+
+static uint64_t nowNanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+static void setValue(const char* value) {
+    unsigned long parsed;
+    if (commandParseUnsigned(value, parsed)) sink = sink + parsed;
+}
+static void touch(const char* value) {
+    sink = sink + (unsigned char)value[0];
+}
+
+constexpr char RED_KEY[] = "RED";
+constexpr char YELLOW_KEY[] = "YELLOW";
+constexpr char GREEN_KEY[] = "GREEN";
+constexpr char MODE_KEY[] = "MODE";
+constexpr char HIST_KEY[] = "HIST";
+constexpr char STATS_KEY[] = "STATS";
+constexpr char TRACE_KEY[] = "TRACE";
+
+typedef CommandTable<
+    CommandEntry<RED_KEY, setValue>,
+    CommandEntry<YELLOW_KEY, setValue>,
+    CommandEntry<GREEN_KEY, setValue>,
+    CommandEntry<HIST_KEY, touch>,
+    CommandEntry<STATS_KEY, touch>,
+    CommandEntry<TRACE_KEY, touch>,
+    CommandEntry<MODE_KEY, touch>
+> Commands;
+
+static bool chainDispatch(const char* param, const char* value) {
+    if (strcmp(param, "RED") == 0) sink = sink + atol(value);
+    else if (strcmp(param, "YELLOW") == 0) sink = sink + atol(value);
+    else if (strcmp(param, "GREEN") == 0) sink = sink + atol(value);
+    else if (strcmp(param, "MODE") == 0) sink = sink + (unsigned char)value[0];
+    else if (strcmp(param, "HIST") == 0) sink = sink + (unsigned char)value[0];
+    else if (strcmp(param, "STATS") == 0) sink = sink + (unsigned char)value[0];
+    else if (strcmp(param, "TRACE") == 0) sink = sink + (unsigned char)value[0];
+    else return false;
+    return true;
+}
+
+static bool tableDispatch(const char* param, const char* value) {
+    return Commands::dispatch(param, value);
+}
+
+// 호출 한 번의 평균 ns
+static double measure(bool (*dispatch)(const char*, const char*), const char* param, const char* value) {
+    char paramBuffer[16];
+    char valueBuffer[16];
+    strcpy(paramBuffer, param);
+    strcpy(valueBuffer, value);
+    const char* volatile p = paramBuffer; // 상수 접기 방지
+    const char* volatile v = valueBuffer;
+    uint64_t start = nowNanos();
+    for (long i = 0; i < BENCH_REPEAT; i++) dispatch(p, v);
+    return (double)(nowNanos() - start) / BENCH_REPEAT;
+}
+
+int main() {
+    static const char* const commands[][2] = {
+        { "RED", "3000" }, { "GREEN", "2000" }, { "MODE", "NORMAL" }, { "TRACE", "DUMP" }, { "FOO", "1" }
+    };
+    const size_t count = sizeof(commands) / sizeof(commands[0]);
+    printf("[\n");
+    for (size_t i = 0; i < count; i++) {
+        double chain = measure(chainDispatch, commands[i][0], commands[i][1]);
+        double table = measure(tableDispatch, commands[i][0], commands[i][1]);
+        printf("{\"command\":\"%s:%s\",\"chain_ns\":%.2f,\"table_ns\":%.2f}%s\n",
+               commands[i][0], commands[i][1], chain, table, i + 1 == count ? "" : ",");
+    }
+    printf("]\n");
+    return 0;
+}
@@ -0,0 +1,101 @@
+// 한 단계씩 실행하는 Task의 단계당 비용 비교 (host 전용, C++20)
+// - switch: 상태 변수 + switch (main.cpp의 normalSequence 방식)
+// - yield: Task::yield()로 단계마다 콜백 포인터 교체
+// - coroutine: TaskCoroutine, 단계마다 co_await sleepFor(0)
+// bench/run_coroutine_bench.sh 가 빌드하여 실행한다.
+// 출력: JSON 객체 한 개 (방식별 단계당 ns 백분위수, pass 한 번에 단계 하나)
+
+#include <algorithm>
+#include <stdio.h>
+#include <time.h>
+
+#include <TaskScheduler.h>
+#include "task_coroutine.h"
+
+#define BENCH_STEPS 5 // 순서 한 바퀴의 단계 수
+#define BENCH_PASSES 1000 // 샘플 하나에 포함되는 pass 수 (pass 한 번 = 단계 하나)
+#define BENCH_SAMPLES 2000 // 샘플 수
+
+static uint64_t nowNanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+uint32_t external_millis() {
+    return (uint32_t)(nowNanos() / 1000000);
+}
+
+uint32_t external_micros() {
+    return (uint32_t)(nowNanos() / 1000);
+}
+
+volatile unsigned long stepCount = 0; // 최적화로 단계가 사라지지 않도록
+
+static Scheduler runner;
+static Task tStep(TASK_IMMEDIATE, TASK_FOREVER, NULL, &runner, false);
+static double samples[BENCH_SAMPLES];
+
+// switch
+static int state = 0;
+static void switchStep() {
+    switch (state) {
+        case 0: stepCount = stepCount + 1; state = 1; break;
+        case 1: stepCount = stepCount + 1; state = 2; break;
+        case 2: stepCount = stepCount + 1; state = 3; break;
+        case 3: stepCount = stepCount + 1; state = 4; break;
+        case 4: stepCount = stepCount + 1; state = 0; break;
+    }
+}
+
+// yield
+static void yieldStep0();
+static void yieldStep1() { stepCount = stepCount + 1; tStep.yield(&yieldStep0); }
+static void yieldStep2() { stepCount = stepCount + 1; tStep.yield(&yieldStep1); }
+static void yieldStep3() { stepCount = stepCount + 1; tStep.yield(&yieldStep2); }
+static void yieldStep4() { stepCount = stepCount + 1; tStep.yield(&yieldStep3); }
+static void yieldStep0() { stepCount = stepCount + 1; tStep.yield(&yieldStep4); }
+
+// coroutine
+static TaskCoroutine steps() {
+    for (;;) {
+        for (int i = 0; i < BENCH_STEPS; i++) {
+            stepCount = stepCount + 1;
+            co_await sleepFor(0);
+        }
+    }
+}
+
+static TaskCoroutine routine;
+static void coroutineStep() {
+    routine.resume();
+}
+
+// 샘플마다 BENCH_PASSES 번 execute()를 실행하고 단계당 ns 기록
+static void measure(const char* name, TaskCallback callback) {
+    tStep.setCallback(callback);
+    tStep.enable();
+    for (int i = 0; i < BENCH_PASSES; i++) runner.execute(); // 워밍업
+    for (int s = 0; s < BENCH_SAMPLES; s++) {
+        uint64_t start = nowNanos();
+        for (int i = 0; i < BENCH_PASSES; i++) runner.execute();
+        samples[s] = (double)(nowNanos() - start) / BENCH_PASSES;
+    }
+    tStep.disable();
+
+    std::sort(samples, samples + BENCH_SAMPLES);
+    printf("\"%s\":{\"p50\":%.2f,\"p90\":%.2f,\"p99\":%.2f,\"max\":%.2f},", name, samples[BENCH_SAMPLES / 2],
+           samples[BENCH_SAMPLES * 9 / 10], samples[BENCH_SAMPLES * 99 / 100], samples[BENCH_SAMPLES - 1]);
+}
+
+int main() {
+    routine = steps();
+    routine.bind(tStep);
+
+    printf("{");
+    measure("switch_ns", &switchStep);
+    measure("yield_ns", &yieldStep0);
+    measure("coroutine_ns", &coroutineStep);
+    printf("\"steps\":%lu}\n", stepCount);
+    return 0;
+}
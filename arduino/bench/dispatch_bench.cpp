@@ -0,0 +1,94 @@
+// TaskScheduler 디스패치 비용 측정 (host 전용)
+// bench/run_bench.sh 가 컴파일 옵션 조합마다 빌드하여 실행한다.
+// 출력: JSON 객체 한 개 (Task/Scheduler 크기, 디스패치당 ns, idle pass당 ns 백분위수)
+
+#include <algorithm>
+#include <stdio.h>
+#include <time.h>
+
+#include <TaskScheduler.h>
+
+#define BENCH_TASKS 10 // 측정에 사용하는 Task 수
+#define BENCH_PASSES 100 // 샘플 하나에 포함되는 pass 수
+#define BENCH_SAMPLES 2000 // 샘플 수
+
+static uint64_t nowNanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+uint32_t external_millis() {
+    return (uint32_t)(nowNanos() / 1000000);
+}
+
+uint32_t external_micros() {
+    return (uint32_t)(nowNanos() / 1000);
+}
+
+volatile unsigned long callbackCount = 0; // 최적화로 콜백이 사라지지 않도록
+
+#ifdef _TASK_OO_CALLBACKS
+class BenchTask : public Task {
+  public:
+    BenchTask() : Task(TASK_IMMEDIATE, TASK_FOREVER, NULL, false) {}
+    bool Callback() { callbackCount = callbackCount + 1; return true; }
+};
+#else
+static void benchCallback() {
+    callbackCount = callbackCount + 1;
+}
+
+class BenchTask : public Task {
+  public:
+    BenchTask() : Task(TASK_IMMEDIATE, TASK_FOREVER, &benchCallback, NULL, false) {}
+};
+#endif // _TASK_OO_CALLBACKS
+
+static Scheduler runner;
+static BenchTask tasks[BENCH_TASKS];
+static double samples[BENCH_SAMPLES];
+
+// 샘플마다 BENCH_PASSES 번 execute()를 실행하고 단위 작업당 ns 기록
+static void measure(unsigned long unitsPerPass) {
+    for (int i = 0; i < BENCH_PASSES * 10; i++) runner.execute(); // 워밍업
+    for (int s = 0; s < BENCH_SAMPLES; s++) {
+        uint64_t start = nowNanos();
+        for (int i = 0; i < BENCH_PASSES; i++) runner.execute();
+        samples[s] = (double)(nowNanos() - start) / (BENCH_PASSES * unitsPerPass);
+    }
+    std::sort(samples, samples + BENCH_SAMPLES);
+}
+
+static double percentile(double p) {
+    return samples[(int)(p * (BENCH_SAMPLES - 1))];
+}
+
+static void printPercentiles(const char* name) {
+    printf("\"%s\":{\"p50\":%.2f,\"p90\":%.2f,\"p99\":%.2f,\"max\":%.2f}",
+           name, percentile(0.50), percentile(0.90), percentile(0.99), samples[BENCH_SAMPLES - 1]);
+}
+
+int main(int argc, char** argv) {
+    const char* options = argc > 1 ? argv[1] : "";
+
+    for (int i = 0; i < BENCH_TASKS; i++) {
+        runner.addTask(tasks[i]);
+        tasks[i].enable();
+    }
+
+    printf("{\"options\":\"%s\",\"task_bytes\":%zu,\"scheduler_bytes\":%zu,",
+           options, sizeof(Task), sizeof(Scheduler));
+
+    // 모든 Task가 매 pass 실행되는 경우: 디스패치 1회당 비용
+    measure(BENCH_TASKS);
+    printPercentiles("dispatch_ns");
+    printf(",");
+
+    // 실행할 Task가 없는 경우: idle pass 1회당 비용
+    for (int i = 0; i < BENCH_TASKS; i++) tasks[i].setInterval(TASK_HOUR);
+    measure(1);
+    printPercentiles("idle_pass_ns");
+    printf("}\n");
+    return 0;
+}
@@ -0,0 +1,117 @@
+// LED 출력 방식별 PWM 쓰기 횟수, 밝기 계산 횟수와 지각 선형성 비교 (host 전용)
+// - always: 20ms마다 세 LED 모두 color * brightness / 255를 계산하고 PWM을 씀 (이전 updateLEDs())
+// - dirty: setLEDColors()/readPotentiometer()가 표시한 뒤에만 ledScale() + ledGamma() 표로 계산하여 씀 (include/led_gamma.h)
+// 1시간 동안의 일반모드 신호 전환에 가변저항 고정(steady) / 20ms마다 변경(pot_sweep)을 더한다.
+// Uno에서 비용의 대부분은 PWM 쓰기(analogWrite())와 곱셈/나눗셈이므로 초당 횟수로 비교한다.
+// 마지막 줄은 밝기 0~255에 대한 CIE L* 오차 (목표: 밝기에 비례하는 L*, 최대 100)
+// bench/run_led_bench.sh 가 빌드하여 실행한다.
+// 출력: JSON 배열
+
+#include <math.h>
+#include <stdio.h>
+
+#include "led_gamma.h"
+
+#define BENCH_MILLIS 3600000UL // 1시간
+#define BENCH_TICK_MILLIS 20 // tPeriodic 주기
+
+static volatile uint8_t pwmRegisters[3]; // 비교 레지스터 대신
+static unsigned long pwmWrites = 0;
+static unsigned long scaleOps = 0;
+
+static void pwmWrite(uint8_t channel, uint8_t value) {
+    pwmRegisters[channel] = value;
+    pwmWrites++;
+}
+
+// main.cpp와 같은 상태
+static int currentRedValue = 0;
+static int currentYellowValue = 0;
+static int currentGreenValue = 0;
+static int brightness = 0;
+static bool ledsDirty = true;
+
+static void setLEDColors(int r, int y, int g) {
+    currentRedValue = r;
+    currentYellowValue = y;
+    currentGreenValue = g;
+    ledsDirty = true;
+}
+
+static void updateAlways() {
+    pwmWrite(0, currentRedValue * brightness / 255);
+    pwmWrite(1, currentYellowValue * brightness / 255);
+    pwmWrite(2, currentGreenValue * brightness / 255);
+    scaleOps += 3;
+}
+
+static void updateDirty() {
+    if (!ledsDirty) return;
+    ledsDirty = false;
+    pwmWrite(0, ledGamma(ledScale(currentRedValue, brightness)));
+    pwmWrite(1, ledGamma(ledScale(currentYellowValue, brightness)));
+    pwmWrite(2, ledGamma(ledScale(currentGreenValue, brightness)));
+    scaleOps += 3;
+}
+
+// 일반모드 한 주기 (R, Y, G 색상, 유지 시간 ms)
+struct Step {
+    int r, y, g;
+    unsigned long millis;
+};
+static const Step cycle[] = {
+    { 255, 0, 0, 2000 }, { 0, 255, 0, 500 }, { 0, 0, 255, 2000 },
+    { 0, 0, 0, 166 }, { 0, 0, 255, 166 }, { 0, 0, 0, 166 }, { 0, 0, 255, 166 }, { 0, 0, 0, 166 }, { 0, 0, 255, 166 },
+    { 0, 255, 0, 500 }
+};
+
+static void runScenario(const char* name, bool sweep, void (*update)(), const char* method, bool last) {
+    pwmWrites = 0;
+    scaleOps = 0;
+    brightness = 128;
+    ledsDirty = true;
+    size_t step = 0;
+    unsigned long nextStep = 0;
+    for (unsigned long ms = 0; ms < BENCH_MILLIS; ms += BENCH_TICK_MILLIS) {
+        if (ms >= nextStep) { // tNormal
+            setLEDColors(cycle[step].r, cycle[step].y, cycle[step].g);
+            nextStep = ms + cycle[step].millis;
+            step = (step + 1) % (sizeof(cycle) / sizeof(cycle[0]));
+        }
+        if (sweep) { // readPotentiometer(): 3 넘게 바뀔 때만 갱신
+            brightness = (brightness + 5) % 256;
+            ledsDirty = true;
+        }
+        update(); // tPeriodic
+    }
+    double seconds = BENCH_MILLIS / 1000.0;
+    printf("{\"scenario\":\"%s\",\"method\":\"%s\",\"pwm_writes_per_s\":%.2f,\"scale_ops_per_s\":%.2f}%s\n",
+           name, method, pwmWrites / seconds, scaleOps / seconds, last ? "" : ",");
+}
+
+// 상대 휘도 -> CIE L*
+static double lightness(double luminance) {
+    return luminance > 0.008856 ? 116.0 * cbrt(luminance) - 16.0 : 903.3 * luminance;
+}
+
+int main() {
+    printf("[\n");
+    runScenario("steady", false, updateAlways, "always", false);
+    runScenario("steady", false, updateDirty, "dirty", false);
+    runScenario("pot_sweep", true, updateAlways, "always", false);
+    runScenario("pot_sweep", true, updateDirty, "dirty", false);
+
+    double linearError = 0;
+    double gammaError = 0;
+    for (int level = 0; level < 256; level++) {
+        double target = level * 100.0 / 255.0;
+        double linear = fabs(lightness(level / 255.0) - target);
+        double gamma = fabs(lightness(ledGamma((uint8_t)level) / 255.0) - target);
+        if (linear > linearError) linearError = linear;
+        if (gamma > gammaError) gammaError = gamma;
+    }
+    printf("{\"lightness_error_max\":{\"always\":%.2f,\"dirty\":%.2f},\"lightness_at_128\":{\"always\":%.1f,\"dirty\":%.1f}}\n",
+           linearError, gammaError, lightness(128 / 255.0), lightness(ledGamma(128) / 255.0));
+    printf("]\n");
+    return 0;
+}
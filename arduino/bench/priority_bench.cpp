@@ -0,0 +1,182 @@
+// 우선순위 스케줄링 비교 (host 전용)
+// - 기본: TaskScheduler _TASK_PRIORITY 계층 (기본 Scheduler + 높은 우선순위 Scheduler)
+// - -D_STATIC_SCHEDULER: include/static_scheduler.h 의 우선순위 테이블
+// bench/run_priority_bench.sh 가 두 방식으로 빌드하여 실행한다.
+// 출력: JSON 객체 한 개
+// - idle_pass_ns: 실행할 Task가 없을 때 pass 한 번의 비용 (실제 시간)
+// - high_latency_us: 높은 우선순위 Task가 예정 시각보다 늦게 시작한 시간 (가상 시계)
+//   낮은 우선순위 콜백은 가상 시계를 BENCH_WORK_MICROS 만큼 진행시켜 긴 작업을 흉내낸다.
+//   작업 시간이 1ms의 배수가 아니므로 스케줄러의 ms 시각과 어긋난 지연도 us 단위로 드러난다.
+// - high_handoff_ns: 낮은 우선순위 콜백이 끝난 뒤 기다리던 높은 우선순위 콜백이 시작하기까지 (실제 시간)
+//   두 방식 모두 콜백을 중간에 끊지 않으므로 차이는 이 디스패치 경로 비용뿐이다.
+
+#include <algorithm>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef _STATIC_SCHEDULER
+#include "static_scheduler.h"
+#else
+#ifndef _TASK_PRIORITY
+#error "_TASK_PRIORITY 또는 _STATIC_SCHEDULER로 빌드하세요"
+#endif
+#include <TaskScheduler.h>
+#endif
+
+#define BENCH_LOW_TASKS 8 // 낮은 우선순위 Task 수
+#define BENCH_HIGH_TASKS 2 // 높은 우선순위 Task 수
+#define BENCH_LOW_INTERVAL 40 // 낮은 우선순위 Task 주기 (ms)
+#define BENCH_HIGH_INTERVAL 5 // 높은 우선순위 Task 주기 (ms)
+#define BENCH_WORK_MICROS 1370 // 낮은 우선순위 콜백 하나의 실행 시간 (가상 시계)
+#define BENCH_IDLE_STEP 10 // idle pass 후 가상 시계 진행 (us)
+#define BENCH_SECONDS 60 // 지연 측정 시간 (가상 시계)
+#define BENCH_PASSES 100 // idle pass 샘플 하나에 포함되는 pass 수
+#define BENCH_SAMPLES 2000 // idle pass 샘플 수
+#define BENCH_MAX_LATENCIES (BENCH_SECONDS * 1000 / BENCH_HIGH_INTERVAL * BENCH_HIGH_TASKS)
+
+static uint64_t virtualMicros = 0; // 가상 시계
+
+static uint64_t nowNanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+uint32_t external_millis() {
+    return (uint32_t)(virtualMicros / 1000);
+}
+
+uint32_t external_micros() {
+    return (uint32_t)virtualMicros;
+}
+
+uint32_t halMillis() {
+    return external_millis();
+}
+
+static double latencies[BENCH_MAX_LATENCIES];
+static int latencyCount = 0;
+static uint64_t highDue[BENCH_HIGH_TASKS]; // 높은 우선순위 Task의 다음 예정 시각 (us)
+static double samples[BENCH_SAMPLES];
+static double handoffs[BENCH_MAX_LATENCIES];
+static int handoffCount = 0;
+static uint64_t lowEndNanos = 0; // 마지막 낮은 우선순위 콜백이 끝난 시각 (실제 시간)
+static bool afterLow = false; // 바로 앞에 실행한 콜백이 낮은 우선순위
+
+static void lowCallback() {
+    virtualMicros += BENCH_WORK_MICROS;
+    afterLow = true;
+    lowEndNanos = nowNanos();
+}
+
+template <int index>
+void highCallback() {
+    uint64_t start = nowNanos();
+    if (afterLow && handoffCount < BENCH_MAX_LATENCIES) handoffs[handoffCount++] = (double)(start - lowEndNanos);
+    afterLow = false;
+    if (latencyCount < BENCH_MAX_LATENCIES) latencies[latencyCount++] = (double)(virtualMicros - highDue[index]);
+    highDue[index] += BENCH_HIGH_INTERVAL * 1000;
+}
+
+#ifdef _STATIC_SCHEDULER
+Task low0(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low1(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low2(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low3(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low4(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low5(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low6(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task low7(BENCH_LOW_INTERVAL, TASK_FOREVER, false);
+Task high0(BENCH_HIGH_INTERVAL, TASK_FOREVER, false);
+Task high1(BENCH_HIGH_INTERVAL, TASK_FOREVER, false);
+
+typedef StaticTaskTable<
+    StaticTask<low0, lowCallback>, StaticTask<low1, lowCallback>,
+    StaticTask<low2, lowCallback>, StaticTask<low3, lowCallback>,
+    StaticTask<low4, lowCallback>, StaticTask<low5, lowCallback>,
+    StaticTask<low6, lowCallback>, StaticTask<low7, lowCallback>,
+    StaticTask<high0, highCallback<0>, 1>, StaticTask<high1, highCallback<1>, 1>
+> BenchTable;
+
+static Scheduler runner(&BenchTable::execute);
+static Task* lowTasks[BENCH_LOW_TASKS] = { &low0, &low1, &low2, &low3, &low4, &low5, &low6, &low7 };
+static Task* highTasks[BENCH_HIGH_TASKS] = { &high0, &high1 };
+
+static void setupTasks() {}
+#else
+static Scheduler runner;
+static Scheduler highRunner;
+static Task* lowTasks[BENCH_LOW_TASKS];
+static Task* highTasks[BENCH_HIGH_TASKS];
+static void (*highCallbacks[BENCH_HIGH_TASKS])() = { &highCallback<0>, &highCallback<1> };
+
+static void setupTasks() {
+    for (int i = 0; i < BENCH_LOW_TASKS; i++) {
+        lowTasks[i] = new Task(BENCH_LOW_INTERVAL, TASK_FOREVER, &lowCallback, &runner, false);
+    }
+    for (int i = 0; i < BENCH_HIGH_TASKS; i++) {
+        highTasks[i] = new Task(BENCH_HIGH_INTERVAL, TASK_FOREVER, highCallbacks[i], &highRunner, false);
+    }
+    runner.setHighPriorityScheduler(&highRunner);
+}
+#endif // _STATIC_SCHEDULER
+
+static double percentile(double* values, int count, double p) {
+    return values[(int)(p * (count - 1))];
+}
+
+static void printPercentiles(const char* name, double* values, int count) {
+    std::sort(values, values + count);
+    printf("\"%s\":{\"p50\":%.2f,\"p90\":%.2f,\"p99\":%.2f,\"max\":%.2f}", name, percentile(values, count, 0.50),
+           percentile(values, count, 0.90), percentile(values, count, 0.99), values[count - 1]);
+}
+
+// 실행할 Task가 없는 pass의 비용
+static void measureIdlePass() {
+    for (int i = 0; i < BENCH_LOW_TASKS; i++) lowTasks[i]->enableDelayed(TASK_HOUR);
+    for (int i = 0; i < BENCH_HIGH_TASKS; i++) highTasks[i]->enableDelayed(TASK_HOUR);
+
+    for (int i = 0; i < BENCH_PASSES * 10; i++) runner.execute(); // 워밍업
+    for (int s = 0; s < BENCH_SAMPLES; s++) {
+        uint64_t start = nowNanos();
+        for (int i = 0; i < BENCH_PASSES; i++) runner.execute();
+        samples[s] = (double)(nowNanos() - start) / BENCH_PASSES;
+    }
+}
+
+// 낮은 우선순위 콜백이 길 때 높은 우선순위 Task의 시작 지연
+static void measureLatency() {
+    virtualMicros = 0;
+    for (int i = 0; i < BENCH_LOW_TASKS; i++) lowTasks[i]->restartDelayed(BENCH_HIGH_INTERVAL - 1); // 낮은 우선순위 Task가 한꺼번에 실행
+    for (int i = 0; i < BENCH_HIGH_TASKS; i++) {
+        highTasks[i]->restartDelayed(BENCH_HIGH_INTERVAL);
+        highDue[i] = BENCH_HIGH_INTERVAL * 1000;
+    }
+
+    while (virtualMicros < (uint64_t)BENCH_SECONDS * 1000000) {
+        if (runner.execute()) {
+            virtualMicros += BENCH_IDLE_STEP;
+            afterLow = false;
+        }
+    }
+}
+
+int main() {
+    setupTasks();
+
+#ifdef _STATIC_SCHEDULER
+    printf("{\"scheduler\":\"static\",");
+#else
+    printf("{\"scheduler\":\"_TASK_PRIORITY\",");
+#endif
+    measureIdlePass();
+    printPercentiles("idle_pass_ns", samples, BENCH_SAMPLES);
+    printf(",");
+    measureLatency();
+    printPercentiles("high_latency_us", latencies, latencyCount);
+    printf(",");
+    printPercentiles("high_handoff_ns", handoffs, handoffCount);
+    printf(",\"handoffs\":%d", handoffCount);
+    printf(",\"high_runs\":%d}\n", latencyCount);
+    return 0;
+}
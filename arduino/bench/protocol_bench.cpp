@@ -0,0 +1,118 @@
+// 텍스트 프로토콜과 바이너리 프레임(COBS + CRC-8)의 메시지 크기와 9600bps 처리량 비교 (host 전용)
+// - text: 장치는 Serial.println() ("\r\n" 포함), 호스트는 "\n"으로 끝나는 줄
+// - binary: frameEncode() 프레임 (0x00 포함, src/frame_codec.cpp)
+// 초당 메시지 수는 9600bps 8N1(바이트당 10비트, 초당 960바이트)에서 선로 시간만으로 계산한다.
+// encode_ns/decode_ns는 host에서 프레임 하나를 만들고/푸는 평균 시간 (BENCH_REPEAT번 반복).
+// 마지막 줄은 일반모드 한 주기(신호 전환 10번)의 선로 시간과, 모든 프레임의 1비트 오류 검출 결과.
+// bench/run_protocol_bench.sh 가 빌드하여 실행한다.
+// 출력: JSON 배열
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "frame_codec.h"
+#include "serial_protocol.h"
+
+#define BENCH_REPEAT 1000000
+#define BENCH_BYTES_PER_SECOND 960.0 // 9600bps, 8N1
+
+static volatile unsigned long sink = 0; // 최적화로 인코딩이 사라지지 않도록
+
+static uint64_t nowNanos() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+struct Message {
+    const char* name;
+    const char* text; // 텍스트 프로토콜의 같은 메시지
+    bool fromHost; // 호스트 -> 장치 (줄 끝이 "\n"만)
+    uint8_t length;
+    uint8_t data[PROTOCOL_MESSAGE_SIZE];
+};
+
+static const Message messages[] = {
+    { "lights_red", "RED", false, 2, { PROTOCOL_LIGHTS, PROTOCOL_RED } },
+    { "lights_off", "ALL_LEDs_OFF", false, 2, { PROTOCOL_LIGHTS, 0 } },
+    { "lights_all", "BLINKING_ALL_ON", false, 2, { PROTOCOL_LIGHTS, PROTOCOL_RED | PROTOCOL_YELLOW | PROTOCOL_GREEN } },
+    { "mode", "MODE:EMERGENCY", false, 2, { PROTOCOL_MODE, 1 } },
+    { "brightness", "Brightness: 123", false, 2, { PROTOCOL_BRIGHTNESS, 123 } },
+    { "duration", "RED_DURATION:3000", false, 6, { PROTOCOL_DURATION, PROTOCOL_RED, 0xB8, 0x0B, 0, 0 } },
+    { "text", "TASK_REJECTED", false, 14, { PROTOCOL_TEXT, 'T', 'A', 'S', 'K', '_', 'R', 'E', 'J', 'E', 'C', 'T', 'E', 'D' } },
+    { "set_duration", "RED:3000", true, 6, { PROTOCOL_SET_DURATION, PROTOCOL_RED, 0xB8, 0x0B, 0, 0 } },
+    { "set_mode", "MODE:NORMAL", true, 2, { PROTOCOL_SET_MODE, 0 } },
+};
+
+static size_t textBytes(const Message& message) {
+    return strlen(message.text) + (message.fromHost ? 1 : 2);
+}
+
+// 일반모드 한 주기의 신호 전환 (RED, YELLOW, GREEN, 깜박임 3번, YELLOW)
+static const char* const cycleTexts[] = {
+    "RED", "YELLOW", "GREEN", "ALL_LEDs_OFF", "GREEN", "ALL_LEDs_OFF", "GREEN", "ALL_LEDs_OFF", "GREEN", "YELLOW"
+};
+
+// 모든 바이트의 모든 비트를 하나씩 뒤집어 받는 쪽(frameDecode() + protocolMessageValid())이 거부하는 횟수
+static void countBitErrors(const uint8_t* frame, size_t length, unsigned long& detected, unsigned long& total) {
+    uint8_t corrupted[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+    uint8_t decoded[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+    for (size_t i = 0; i + 1 < length; i++) { // 끝의 0x00 제외
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            memcpy(corrupted, frame, length - 1);
+            corrupted[i] ^= (uint8_t)(1 << bit);
+            // 0x00이 된 바이트는 수신 쪽에서 프레임 끝이므로 앞부분만 디코딩
+            size_t end = 0;
+            while (end < length - 1 && corrupted[end] != 0) end++;
+            total++;
+            size_t decodedLength = frameDecode(corrupted, end, decoded);
+            if (decodedLength == 0 || !protocolMessageValid(decoded, decodedLength)) detected++;
+        }
+    }
+}
+
+int main() {
+    const size_t count = sizeof(messages) / sizeof(messages[0]);
+    uint8_t frame[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+    uint8_t decoded[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+    unsigned long detected = 0;
+    unsigned long total = 0;
+    bool roundTrip = true;
+
+    printf("[\n");
+    for (size_t i = 0; i < count; i++) {
+        const Message& message = messages[i];
+        size_t binaryBytes = frameEncode(message.data, message.length, frame);
+        size_t decodedLength = frameDecode(frame, binaryBytes - 1, decoded);
+        if (decodedLength != message.length || memcmp(decoded, message.data, message.length) != 0) roundTrip = false;
+        countBitErrors(frame, binaryBytes, detected, total);
+
+        const uint8_t* volatile data = message.data; // 상수 접기 방지
+        uint64_t start = nowNanos();
+        for (long r = 0; r < BENCH_REPEAT; r++) sink = sink + frameEncode(data, message.length, frame);
+        double encodeNanos = (double)(nowNanos() - start) / BENCH_REPEAT;
+        start = nowNanos();
+        for (long r = 0; r < BENCH_REPEAT; r++) sink = sink + frameDecode(frame, binaryBytes - 1, decoded);
+        double decodeNanos = (double)(nowNanos() - start) / BENCH_REPEAT;
+
+        size_t text = textBytes(message);
+        printf("{\"message\":\"%s\",\"text\":\"%s\",\"text_bytes\":%zu,\"binary_bytes\":%zu,"
+               "\"text_msgs_per_s\":%.1f,\"binary_msgs_per_s\":%.1f,\"encode_ns\":%.2f,\"decode_ns\":%.2f},\n",
+               message.name, message.text, text, binaryBytes,
+               BENCH_BYTES_PER_SECOND / text, BENCH_BYTES_PER_SECOND / binaryBytes, encodeNanos, decodeNanos);
+    }
+
+    size_t cycleText = 0;
+    size_t cycleBinary = 0;
+    for (size_t i = 0; i < sizeof(cycleTexts) / sizeof(cycleTexts[0]); i++) {
+        cycleText += strlen(cycleTexts[i]) + 2;
+        cycleBinary += FRAME_SIZE(2); // LIGHTS 프레임은 항상 5바이트
+    }
+    printf("{\"message\":\"normal_cycle\",\"text_bytes\":%zu,\"binary_bytes\":%zu,\"text_line_ms\":%.1f,\"binary_line_ms\":%.1f,"
+           "\"round_trip\":%s,\"bit_errors_detected\":%lu,\"bit_errors\":%lu}\n",
+           cycleText, cycleBinary, cycleText * 1000.0 / BENCH_BYTES_PER_SECOND, cycleBinary * 1000.0 / BENCH_BYTES_PER_SECOND,
+           roundTrip ? "true" : "false", detected, total);
+    printf("]\n");
+    return 0;
+}
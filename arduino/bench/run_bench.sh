@@ -0,0 +1,40 @@
+#!/bin/sh
+# 컴파일 옵션 조합별 TaskScheduler 디스패치 비용 측정
+# 사용법: bench/run_bench.sh > bench.json  (arduino 디렉터리에서 실행)
+# TaskScheduler 경로는 TASKSCHEDULER_DIR 로 지정 (기본: pio run -e native 가 받은 라이브러리)
+
+set -e
+cd "$(dirname "$0")/.."
+
+TS="${TASKSCHEDULER_DIR:-.pio/libdeps/native/TaskScheduler/src}"
+[ -d "$TS" ] || TS=.pio/libdeps/uno/TaskScheduler/src
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/dispatch_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+OPTIONS="_TASK_TIMECRITICAL _TASK_STATUS_REQUEST _TASK_PRIORITY _TASK_STD_FUNCTION _TASK_OO_CALLBACKS _TASK_SCHEDULING_OPTIONS _TASK_THREAD_SAFE"
+COUNT=$(echo $OPTIONS | wc -w)
+
+echo "["
+mask=0
+while [ $mask -lt $((1 << COUNT)) ]; do
+    flags=""
+    names=""
+    bit=0
+    for option in $OPTIONS; do
+        if [ $((mask >> bit & 1)) -eq 1 ]; then
+            flags="$flags -D$option"
+            names="$names $option"
+        fi
+        bit=$((bit + 1))
+    done
+    # TaskScheduler는 std::function을 ESP/STM32 에서만 허용하므로 host에서는 STM32로 표시
+    case "$flags" in *_TASK_STD_FUNCTION*) flags="$flags -DARDUINO_ARCH_STM32" ;; esac
+
+    $CXX -std=gnu++17 -O2 -D_TASK_EXTERNAL_TIME $flags -Iinclude/native -I"$TS" bench/dispatch_bench.cpp -o "$OUT"
+    [ $mask -gt 0 ] && echo ","
+    "$OUT" "${names# }" | tr -d '\n'
+    mask=$((mask + 1))
+done
+echo ""
+echo "]"
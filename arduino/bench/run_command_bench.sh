@@ -0,0 +1,13 @@
+#!/bin/sh
+# 시리얼 명령 선택 방식 비교: strcmp 연쇄 + atol() / 컴파일 타임 완전 해시 표
+# 사용법: bench/run_command_bench.sh > command.json  (arduino 디렉터리에서 실행)
+
+set -e
+cd "$(dirname "$0")/.."
+
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/command_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+$CXX -std=gnu++11 -O2 -Wall -Iinclude bench/command_bench.cpp -o "$OUT"
+"$OUT"
@@ -0,0 +1,17 @@
+#!/bin/sh
+# switch / Task::yield() / TaskCoroutine 단계당 비용 비교 (C++20 필요)
+# 사용법: bench/run_coroutine_bench.sh > coroutine.json  (arduino 디렉터리에서 실행)
+# TaskScheduler 경로는 TASKSCHEDULER_DIR 로 지정 (기본: pio run -e native 가 받은 라이브러리)
+
+set -e
+cd "$(dirname "$0")/.."
+
+TS="${TASKSCHEDULER_DIR:-.pio/libdeps/native/TaskScheduler/src}"
+[ -d "$TS" ] || TS=.pio/libdeps/uno/TaskScheduler/src
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/coroutine_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+$CXX -std=gnu++20 -O2 -Wno-volatile -D_TASK_EXTERNAL_TIME -DTASK_COROUTINE -Iinclude/native -Iinclude -I"$TS" \
+    bench/coroutine_bench.cpp src/task_coroutine.cpp -o "$OUT"
+"$OUT"
@@ -0,0 +1,13 @@
+#!/bin/sh
+# LED 출력 방식 비교: 20ms마다 계산 + PWM 쓰기 / dirty 플래그 + 감마 표 (PWM 쓰기 수, 밝기 계산 수, L* 오차)
+# 사용법: bench/run_led_bench.sh > led.json  (arduino 디렉터리에서 실행)
+
+set -e
+cd "$(dirname "$0")/.."
+
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/led_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+$CXX -std=gnu++11 -O2 -Wall -Iinclude bench/led_bench.cpp src/led_gamma.cpp -o "$OUT" -lm
+"$OUT"
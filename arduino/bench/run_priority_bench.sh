@@ -0,0 +1,22 @@
+#!/bin/sh
+# TaskScheduler _TASK_PRIORITY 계층과 정적 Task 테이블 우선순위 비교
+# 사용법: bench/run_priority_bench.sh > priority.json  (arduino 디렉터리에서 실행)
+# TaskScheduler 경로는 TASKSCHEDULER_DIR 로 지정 (기본: pio run -e native 가 받은 라이브러리)
+
+set -e
+cd "$(dirname "$0")/.."
+
+TS="${TASKSCHEDULER_DIR:-.pio/libdeps/native/TaskScheduler/src}"
+[ -d "$TS" ] || TS=.pio/libdeps/uno/TaskScheduler/src
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/priority_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+echo "["
+$CXX -std=gnu++11 -O2 -D_TASK_EXTERNAL_TIME -D_TASK_PRIORITY -Iinclude/native -I"$TS" bench/priority_bench.cpp -o "$OUT"
+"$OUT" | tr -d '\n'
+echo ","
+$CXX -std=gnu++11 -O2 -D_STATIC_SCHEDULER -Iinclude/native -Iinclude bench/priority_bench.cpp -o "$OUT"
+"$OUT" | tr -d '\n'
+echo ""
+echo "]"
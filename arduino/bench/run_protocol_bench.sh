@@ -0,0 +1,13 @@
+#!/bin/sh
+# 텍스트 프로토콜과 바이너리 프레임(COBS + CRC-8)의 메시지 크기, 9600bps 초당 메시지 수, 인코딩/디코딩 시간 비교
+# 사용법: bench/run_protocol_bench.sh > protocol.json  (arduino 디렉터리에서 실행)
+
+set -e
+cd "$(dirname "$0")/.."
+
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/protocol_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+$CXX -std=gnu++11 -O2 -Wall -Iinclude bench/protocol_bench.cpp src/frame_codec.cpp -o "$OUT"
+"$OUT"
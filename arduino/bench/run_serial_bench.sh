@@ -0,0 +1,13 @@
+#!/bin/sh
+# 시리얼 명령 수신 방식별 processSerial() 최악 실행 시간 비교 (약 12초 소요)
+# 사용법: bench/run_serial_bench.sh > serial.json  (arduino 디렉터리에서 실행)
+
+set -e
+cd "$(dirname "$0")/.."
+
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/serial_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+$CXX -std=gnu++11 -O2 -Iinclude bench/serial_bench.cpp src/serial_line.cpp -o "$OUT"
+"$OUT"
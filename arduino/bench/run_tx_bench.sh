@@ -0,0 +1,14 @@
+#!/bin/sh
+# 시리얼 송신 방식 비교: 콜백에서 바로 println / 우선순위 송신 큐 + 송신 Task (9600bps 가상 선로)
+# 사용법: bench/run_tx_bench.sh > tx.json  (arduino 디렉터리에서 실행)
+
+set -e
+cd "$(dirname "$0")/.."
+
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/tx_bench.$$"
+trap 'rm -f "$OUT"' EXIT
+
+$CXX -std=gnu++11 -O2 -Wall -D_STATIC_SCHEDULER -Iinclude bench/tx_bench.cpp \
+    src/serial_tx.cpp src/serial_protocol.cpp src/serial_line.cpp src/frame_codec.cpp -o "$OUT"
+"$OUT"
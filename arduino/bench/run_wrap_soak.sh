@@ -0,0 +1,71 @@
+#!/bin/sh
+# 32비트 millis 롤오버(약 49.7일)를 지나는 장기 시뮬레이션으로 빠지거나 중복된 Task 실행 확인
+# 사용법: bench/run_wrap_soak.sh [시뮬레이션 시간(h)] > soak.json  (arduino 디렉터리에서 실행)
+#
+# 같은 입력으로 가상 시계를 0에서 시작한 실행과 롤오버 1시간 전에서 시작한 실행의
+# Task별 실행 횟수(TASK_TRACE)와 시리얼 출력을 비교한다. 횟수가 적으면 skipped, 많으면 duplicated.
+# - static: _STATIC_SCHEDULER (32비트 시각)
+# - static_time64: _STATIC_SCHEDULER + _TASK_TIME64
+# - library: TaskScheduler, 컴파일러가 -m32를 지원할 때만 실행
+#   (64비트 host의 unsigned long은 64비트라서 32비트 external_millis()의 롤오버를 Uno와 같게 재현할 수 없음)
+# TaskScheduler 경로는 TASKSCHEDULER_DIR 로 지정 (기본: pio run -e native 가 받은 라이브러리)
+
+set -e
+cd "$(dirname "$0")/.."
+
+HOURS="${1:-336}"
+START=4291367296 # 2^32 - 3600000: 1시간 후 롤오버
+EVENTS="--at 3500000 MODE:BLINKING --at 3700000 MODE:NORMAL --at 7200000 MODE:EMERGENCY --at 7300000 MODE:NORMAL"
+
+TS="${TASKSCHEDULER_DIR:-.pio/libdeps/native/TaskScheduler/src}"
+[ -d "$TS" ] || TS=.pio/libdeps/uno/TaskScheduler/src
+CXX="${CXX:-g++}"
+OUT="${TMPDIR:-/tmp}/wrap_soak.$$"
+trap 'rm -rf "$OUT"' EXIT
+mkdir -p "$OUT"
+
+build() {
+    $CXX -std=gnu++17 -O2 -D_TASK_EXTERNAL_TIME -D_TASK_TICKLESS -DTASK_TRACE "$@" \
+        -Iinclude/native -Iinclude -I"$TS" src/*.cpp
+}
+
+# 실행 결과: "<Task=횟수 ...> <출력 md5>"
+run() {
+    "$1" --sim "$HOURS" --start-ms "$2" $EVENTS --trace /dev/null 2> "$OUT/err" | md5sum | cut -d' ' -f1 > "$OUT/md5"
+    echo "$(sed -n 's/^dispatch: //p' "$OUT/err") $(cat "$OUT/md5")"
+}
+
+FIRST=1
+soak() {
+    [ "$FIRST" = 1 ] || echo ","
+    FIRST=0
+    name="$1"
+    base=$(run "$2" 0)
+    wrap=$(run "$2" "$START")
+    echo "$base" "|" "$wrap" | awk -v name="$name" -v hours="$HOURS" -v start="$START" '{
+        split($0, halves, " [|] ")
+        n = split(halves[1], a, " "); split(halves[2], b, " ")
+        skipped = ""; duplicated = ""
+        for (i = 1; i < n; i++) {
+            split(a[i], x, "="); split(b[i], y, "=")
+            d = y[2] - x[2]
+            skipped = skipped (i > 1 ? "," : "") "\"" x[1] "\":" (d < 0 ? -d : 0)
+            duplicated = duplicated (i > 1 ? "," : "") "\"" x[1] "\":" (d > 0 ? d : 0)
+        }
+        printf "{\"scheduler\":\"%s\",\"hours\":%s,\"start_ms\":%s,\"skipped\":{%s},\"duplicated\":{%s},\"output_match\":%s}",
+            name, hours, start, skipped, duplicated, (a[n] == b[n] ? "true" : "false")
+    }'
+}
+
+echo "["
+build -D_STATIC_SCHEDULER -o "$OUT/static"
+soak static "$OUT/static"
+build -D_STATIC_SCHEDULER -D_TASK_TIME64 -o "$OUT/static_time64"
+soak static_time64 "$OUT/static_time64"
+if build -m32 -D_TASK_WDT_IDS -o "$OUT/library" 2> /dev/null; then
+    soak library "$OUT/library"
+else
+    echo "library: $CXX -m32 빌드 불가, 건너뜀" >&2
+fi
+echo
+echo "]"
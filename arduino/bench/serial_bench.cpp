@@ -0,0 +1,147 @@
+// 시리얼 명령 수신 방식별 processSerial() 한 번의 최악 실행 시간 비교 (host 전용)
+// - blocking: 바이트가 하나라도 있으면 Stream::readBytesUntil('\n')로 읽기 (이전 방식, Stream 타임아웃 1초)
+// - nonblocking: serialLineRead(), 도착한 바이트만 읽고 완성된 줄만 반환 (src/serial_line.cpp)
+// 바이트는 실제 시간에 맞춰 도착하고(9600bps, 바이트당 약 1ms), 두 방식 모두 20ms마다 호출한다.
+// bench/run_serial_bench.sh 가 빌드하여 실행한다.
+// 출력: JSON 배열 (시나리오별 호출당 최대/평균 us, 완성된 줄 수)
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "hal.h"
+#include "serial_line.h"
+
+#define BENCH_BYTE_MICROS 1042 // 9600bps에서 바이트 하나 (10비트)
+#define BENCH_PERIOD_MICROS 20000 // tSerial 주기
+#define BENCH_STREAM_TIMEOUT_MILLIS 1000 // Stream::setTimeout() 기본값
+#define BENCH_ROUNDS 3 // 시나리오별 반복 횟수
+#define BENCH_MAX_BYTES 64
+
+static uint64_t nowMicros() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000ULL + (uint64_t)now.tv_nsec / 1000;
+}
+
+// 도착 시각이 정해진 바이트열 (가짜 수신 버퍼)
+static char rxBytes[BENCH_MAX_BYTES];
+static uint64_t rxTimes[BENCH_MAX_BYTES]; // 도착 시각 (us)
+static size_t rxCount = 0;
+static size_t rxNext = 0;
+
+// text를 start부터 9600bps로 보내고, pauseAt 번째 바이트 앞에서 pauseMicros만큼 멈춤
+static void sendAt(uint64_t start, const char* text, size_t pauseAt, uint64_t pauseMicros) {
+    rxCount = 0;
+    rxNext = 0;
+    uint64_t t = start;
+    for (size_t i = 0; text[i] != '\0' && rxCount < BENCH_MAX_BYTES; i++) {
+        if (i == pauseAt) t += pauseMicros;
+        rxBytes[rxCount] = text[i];
+        rxTimes[rxCount] = t;
+        rxCount++;
+        t += BENCH_BYTE_MICROS;
+    }
+}
+
+int halSerialAvailable() {
+    uint64_t now = nowMicros();
+    size_t count = 0;
+    while (rxNext + count < rxCount && rxTimes[rxNext + count] <= now) count++;
+    return (int)count;
+}
+
+int halSerialRead() {
+    if (rxNext < rxCount && rxTimes[rxNext] <= nowMicros()) return (unsigned char)rxBytes[rxNext++];
+    return -1;
+}
+
+// Stream::timedRead()와 같은 동작: 타임아웃까지 바이트를 기다림
+static int timedRead() {
+    uint64_t start = nowMicros();
+    do {
+        int c = halSerialRead();
+        if (c >= 0) return c;
+    } while (nowMicros() - start < BENCH_STREAM_TIMEOUT_MILLIS * 1000ULL);
+    return -1;
+}
+
+// Stream::readBytesUntil()과 같은 동작
+static size_t readBytesUntil(char terminator, char* buffer, size_t length) {
+    size_t index = 0;
+    while (index < length) {
+        int c = timedRead();
+        if (c < 0 || c == terminator) break;
+        buffer[index++] = (char)c;
+    }
+    return index;
+}
+
+static unsigned long lines = 0; // 완성된 줄 수
+
+static void blockingSerial() {
+    if (halSerialAvailable() > 0) {
+        char line[32];
+        size_t length = readBytesUntil('\n', line, sizeof(line) - 1);
+        line[length] = '\0';
+        lines++; // 타임아웃으로 잘린 줄도 명령으로 처리됨
+    }
+}
+
+static void nonblockingSerial() {
+    char* line;
+    while (serialLineRead(line)) lines++;
+}
+
+struct Scenario {
+    const char* name;
+    const char* text;
+    size_t pauseAt; // 이 바이트 앞에서 멈춤
+    uint64_t pauseMicros;
+    uint64_t durationMicros; // 측정 시간
+};
+
+static const Scenario scenarios[] = {
+    { "line", "RED:3000\n", 0, 0, 100000 }, // 한 줄이 9600bps로 도착
+    { "pause_300ms", "MODE:NORMAL\n", 5, 300000, 500000 }, // 보내는 쪽이 "MODE:" 뒤에서 300ms 멈춤
+    { "no_newline", "MODE:OFF", 0, 0, 1300000 }, // 개행이 오지 않음
+};
+
+static void runScenario(const Scenario& scenario, void (*serial)(), const char* method, bool last) {
+    unsigned long maxMicros = 0;
+    uint64_t totalMicros = 0;
+    unsigned long calls = 0;
+    lines = 0;
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        uint64_t start = nowMicros();
+        // 두 번째 호출 직전에 도착 시작 (호출 시점에 줄의 앞 3바이트만 도착)
+        sendAt(start + BENCH_PERIOD_MICROS - 3 * BENCH_BYTE_MICROS, scenario.text, scenario.pauseAt, scenario.pauseMicros);
+        uint64_t next = start;
+        while (nowMicros() - start < scenario.durationMicros) {
+            while (nowMicros() < next) {} // 다음 주기까지 대기
+            uint64_t before = nowMicros();
+            serial();
+            uint64_t elapsed = nowMicros() - before;
+            if (elapsed > maxMicros) maxMicros = (unsigned long)elapsed;
+            totalMicros += elapsed;
+            calls++;
+            next += BENCH_PERIOD_MICROS;
+            if (next < nowMicros()) next = nowMicros(); // 밀린 주기는 건너뜀
+        }
+        char* line;
+        while (serialLineRead(line)) {} // 다음 round를 위해 남은 줄 비우기
+    }
+    printf("{\"scenario\":\"%s\",\"method\":\"%s\",\"max_us\":%lu,\"mean_us\":%.2f,\"lines\":%lu}%s\n",
+           scenario.name, method, maxMicros, calls ? (double)totalMicros / calls : 0.0, lines / BENCH_ROUNDS, last ? "" : ",");
+}
+
+int main() {
+    const size_t count = sizeof(scenarios) / sizeof(scenarios[0]);
+    printf("[\n");
+    for (size_t i = 0; i < count; i++) {
+        runScenario(scenarios[i], blockingSerial, "blocking", false);
+        runScenario(scenarios[i], nonblockingSerial, "nonblocking", i + 1 == count);
+    }
+    printf("]\n");
+    return 0;
+}
@@ -0,0 +1,190 @@
+// 시리얼 송신 방식별 콜백 정지 시간과 상태 메시지 지연 비교 (host 전용, 가상 시계)
+// - blocking: 콜백에서 바로 println (이전 방식), 송신 버퍼가 차면 빈 자리가 날 때까지 기다림
+// - queue: 상태 보고를 송신 큐에 넣고 송신 Task가 빈 자리만큼만 보냄 (src/serial_tx.cpp, src/serial_protocol.cpp)
+// 송신 버퍼는 HardwareSerial처럼 64바이트, 9600bps(바이트당 1042us)로 비워진다.
+// 일반모드 신호 전환에 가변저항을 돌리는 동안의 밝기 보고(20ms마다)와 버튼 입력(1초마다 3줄)을 더한다.
+// bench/run_tx_bench.sh 가 빌드하여 실행한다.
+// 지연은 메시지를 만든 시각부터 마지막 바이트가 선로를 떠난 시각까지 (state: 버튼 줄 포함, lights: 신호 전환만)
+// 출력: JSON 배열 (시나리오, 방식별 콜백 최대/합계 정지 시간, 최대 지연, 밝기 송신/덮어쓰기 수, 큐 통계)
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hal.h"
+#include "serial_protocol.h"
+#include "serial_tx.h"
+
+#define BENCH_BYTE_MICROS 1042 // 9600bps에서 바이트 하나 (10비트)
+#define BENCH_TX_SIZE HAL_SERIAL_TX_SIZE // HardwareSerial 송신 버퍼
+#define BENCH_MILLIS 60000 // 시나리오 길이 (가상 ms)
+#define BENCH_DRAIN_INTERVAL 5 // main.cpp의 TX_DRAIN_INTERVAL
+#define BENCH_EVENTS 64 // 지연을 잴 상태 메시지 FIFO 크기
+
+// 가상 시계와 송신 선로
+static uint64_t nowMicros = 0;
+static uint64_t wireEnd = 0; // 송신 버퍼의 마지막 바이트가 선로를 떠나는 시각
+static uint64_t stallMicros = 0; // 지금 콜백이 송신 버퍼를 기다린 시간
+static unsigned long brightnessLines = 0; // 송신한 밝기 줄 수
+
+// 상태 메시지를 넣은 시각 (송신 순서와 같은 FIFO)
+static uint64_t eventTimes[BENCH_EVENTS];
+static bool eventLights[BENCH_EVENTS]; // 신호 전환 메시지
+static uint8_t eventHead = 0;
+static uint8_t eventTail = 0;
+static uint64_t maxLatencyMicros = 0;
+static uint64_t maxLightsLatencyMicros = 0;
+
+uint32_t halMillis() { return (uint32_t)(nowMicros / 1000); }
+uint32_t halMicros() { return (uint32_t)nowMicros; }
+int halSerialRead() { return -1; }
+int halSerialAvailable() { return 0; }
+
+static int occupied() {
+    return wireEnd > nowMicros ? (int)((wireEnd - nowMicros + BENCH_BYTE_MICROS - 1) / BENCH_BYTE_MICROS) : 0;
+}
+
+int halSerialWritable() {
+    return BENCH_TX_SIZE - 1 - occupied(); // HardwareSerial::availableForWrite()처럼 한 칸은 비워 둠
+}
+
+// n바이트 쓰기, 자리가 없으면 HardwareSerial::write()처럼 기다림 (가상 시계 진행)
+static void transmit(size_t length, bool brightness) {
+    if (occupied() + (int)length > BENCH_TX_SIZE - 1) {
+        uint64_t ready = wireEnd - (uint64_t)(BENCH_TX_SIZE - 1 - length) * BENCH_BYTE_MICROS;
+        stallMicros += ready - nowMicros;
+        nowMicros = ready;
+    }
+    wireEnd = (wireEnd > nowMicros ? wireEnd : nowMicros) + (uint64_t)length * BENCH_BYTE_MICROS;
+    if (brightness) {
+        brightnessLines++;
+    } else if (eventTail != eventHead) {
+        uint8_t index = eventTail++ % BENCH_EVENTS;
+        uint64_t latency = wireEnd - eventTimes[index];
+        if (latency > maxLatencyMicros) maxLatencyMicros = latency;
+        if (eventLights[index] && latency > maxLightsLatencyMicros) maxLightsLatencyMicros = latency;
+    }
+}
+
+void halSerialWrite(const uint8_t* data, size_t length) { transmit(length, data[1] == PROTOCOL_BRIGHTNESS); }
+void halSerialPrint(const char* text) { (void)text; }
+void halSerialPrint(long value) { (void)value; }
+void halSerialPrint(unsigned long value) { (void)value; }
+void halSerialPrintln(const char* text) { transmit(strlen(text) + 2, strncmp(text, "Brightness", 10) == 0); }
+void halSerialPrintln(long value) { (void)value; }
+void halSerialPrintln(unsigned long value) { (void)value; }
+
+Task tSerialTx(BENCH_DRAIN_INTERVAL, TASK_FOREVER);
+
+// main.cpp의 drainSerial()과 같음 (남은 메시지가 들어갈 만큼 송신 버퍼가 비는 시각에 다시 실행)
+static void drainSerial() {
+    unsigned int waiting = protocolDrain();
+    if (waiting == 0) tSerialTx.disable();
+    else tSerialTx.delay((waiting * BENCH_BYTE_MICROS + 999) / 1000);
+}
+
+typedef StaticTaskTable<StaticTask<tSerialTx, drainSerial> > TaskTable;
+static Scheduler runner(&TaskTable::execute);
+
+static bool queued = false; // 현재 방식
+
+static void stateMessage(const char* text, uint8_t lights, bool isLights) {
+    eventLights[eventHead % BENCH_EVENTS] = isLights;
+    eventTimes[eventHead++ % BENCH_EVENTS] = nowMicros;
+    if (!queued) halSerialPrintln(text);
+    else if (isLights) protocolSendLights(lights);
+    else protocolSendText(text);
+}
+
+static void brightnessMessage(uint8_t brightness) {
+    if (queued) {
+        protocolSendBrightness(brightness);
+    } else {
+        char line[20];
+        snprintf(line, sizeof(line), "Brightness: %u", brightness);
+        halSerialPrintln(line);
+    }
+}
+
+// 일반모드 한 주기 (신호, LED 비트, 유지 시간 ms)
+struct Step {
+    const char* text;
+    uint8_t lights;
+    unsigned long millis;
+};
+static const Step cycle[] = {
+    { "RED", PROTOCOL_RED, 2000 }, { "YELLOW", PROTOCOL_YELLOW, 500 }, { "GREEN", PROTOCOL_GREEN, 2000 },
+    { "ALL_LEDs_OFF", 0, 166 }, { "GREEN", PROTOCOL_GREEN, 166 }, { "ALL_LEDs_OFF", 0, 166 },
+    { "GREEN", PROTOCOL_GREEN, 166 }, { "ALL_LEDs_OFF", 0, 166 }, { "GREEN", PROTOCOL_GREEN, 166 },
+    { "YELLOW", PROTOCOL_YELLOW, 500 }
+};
+
+struct Scenario {
+    const char* name;
+    bool potentiometer; // 20ms마다 밝기 변경
+    bool buttons; // 1초마다 버튼 3줄
+};
+
+static const Scenario scenarios[] = {
+    { "lights", false, false },
+    { "lights_pot", true, false },
+    { "lights_pot_buttons", true, true },
+};
+
+static void runScenario(const Scenario& scenario, bool queue, bool last) {
+    queued = queue;
+    nowMicros = 0;
+    wireEnd = 0;
+    eventHead = eventTail = 0;
+    maxLatencyMicros = 0;
+    maxLightsLatencyMicros = 0;
+    brightnessLines = 0;
+    TxStats before = txStats();
+
+    uint64_t maxStall = 0;
+    uint64_t totalStall = 0;
+    size_t step = 0;
+    unsigned long nextStep = 0;
+    uint8_t brightness = 0;
+
+    for (unsigned long ms = 0; ms < BENCH_MILLIS; ms++) {
+        if (nowMicros < ms * 1000ULL) nowMicros = ms * 1000ULL; // 앞 콜백이 기다린 만큼은 밀림
+        stallMicros = 0;
+        if (ms >= nextStep) { // tNormal
+            stateMessage(cycle[step].text, cycle[step].lights, true);
+            nextStep = ms + cycle[step].millis;
+            step = (step + 1) % (sizeof(cycle) / sizeof(cycle[0]));
+        }
+        if (scenario.buttons && ms % 1000 == 500) { // tButtons
+            stateMessage("Blinking button pressed", 0, false);
+            stateMessage("TASK_REJECTED", 0, false);
+            stateMessage("INVALID_VALUE", 0, false);
+        }
+        if (scenario.potentiometer && ms % 20 == 0) { // tPeriodic
+            brightness = (uint8_t)(brightness + 7);
+            brightnessMessage(brightness);
+        }
+        if (queue) runner.execute(); // tSerialTx
+        if (stallMicros > maxStall) maxStall = stallMicros;
+        totalStall += stallMicros;
+    }
+    while (txPeek() != NULL) txPop(); // 다음 시나리오를 위해 비우기
+
+    const TxStats& after = txStats();
+    printf("{\"scenario\":\"%s\",\"method\":\"%s\",\"stall_max_us\":%llu,\"stall_total_ms\":%.1f,\"state_latency_max_ms\":%.1f,\"lights_latency_max_ms\":%.1f,"
+           "\"brightness_sent\":%lu,\"coalesced\":%lu,\"dropped\":%lu,\"max_depth\":%u}%s\n",
+           scenario.name, queue ? "queue" : "blocking", (unsigned long long)maxStall, totalStall / 1000.0,
+           maxLatencyMicros / 1000.0, maxLightsLatencyMicros / 1000.0, brightnessLines, after.coalesced - before.coalesced, after.dropped - before.dropped,
+           queue ? after.maxDepth : 0, last ? "" : ",");
+}
+
+int main() {
+    txBegin(tSerialTx);
+    const size_t count = sizeof(scenarios) / sizeof(scenarios[0]);
+    printf("[\n");
+    for (size_t i = 0; i < count; i++) {
+        runScenario(scenarios[i], false, false);
+        runScenario(scenarios[i], true, i + 1 == count);
+    }
+    printf("]\n");
+    return 0;
+}
@@ -0,0 +1,98 @@
+#ifndef COMMAND_TABLE_H
+#define COMMAND_TABLE_H
+
+// 컴파일 타임 시리얼 명령 표 (PARAM:VALUE의 PARAM -> 처리 함수)
+// 키마다 strcmp를 이어서 비교하는 대신 PARAM의 8비트 해시로 후보를 하나만 고르고 strcmp는 한 번만 한다.
+// 해시 seed는 표의 키끼리 해시가 겹치지 않는 값을 컴파일 타임에 찾는다 (완전 해시, 없으면 컴파일 오류).
+// 표는 배열 대신 템플릿 재귀로 펼쳐져 상수 비교가 되므로 SRAM을 쓰지 않고, 동적 할당도 없다.
+//
+// 사용 예:
+//   constexpr char RED_KEY[] = "RED";
+//   void redCommand(const char* value);
+//   typedef CommandTable<CommandEntry<RED_KEY, redCommand>, CommandEntry<MODE_KEY, modeCommand> > Commands;
+//   if (!Commands::dispatch(param, value)) { /* 모르는 명령 */ }
+
+#include <stdint.h>
+#include <string.h>
+
+typedef void (*CommandHandler)(const char* value);
+
+// 8비트 해시 (FNV-1a 방식, C++11 constexpr 재귀)
+constexpr uint8_t commandHash(const char* key, uint8_t seed) {
+    return *key ? commandHash(key + 1, (uint8_t)((seed ^ (uint8_t)*key) * 167u)) : seed;
+}
+
+// 10진수 문자열을 unsigned long으로 변환 (숫자 외 문자, 빈 문자열, 범위 초과면 false)
+inline bool commandParseUnsigned(const char* text, unsigned long& value) {
+    if (*text == '\0') return false;
+    unsigned long result = 0;
+    for (; *text; text++) {
+        if (*text < '0' || *text > '9') return false;
+        uint8_t digit = *text - '0';
+        if (result > (0xFFFFFFFFUL - digit) / 10) return false;
+        result = result * 10 + digit;
+    }
+    value = result;
+    return true;
+}
+
+// 명령 하나 (key: 명령 이름 배열, handler: VALUE를 받는 처리 함수)
+template <const char* key, CommandHandler handler>
+struct CommandEntry {
+    static constexpr const char* name() { return key; }
+    static void run(const char* value) { handler(value); }
+};
+
+// 표 내부 재귀 (CommandTable에서 사용)
+template <typename... Entries>
+struct CommandList;
+
+template <>
+struct CommandList<> {
+    static constexpr bool lacks(uint8_t, uint8_t) { return true; }
+    static constexpr bool perfect(uint8_t) { return true; }
+    template <uint8_t seed>
+    static bool dispatch(uint8_t, const char*, const char*) { return false; }
+};
+
+template <typename First, typename... Rest>
+struct CommandList<First, Rest...> {
+    typedef CommandList<Rest...> Next;
+
+    // 이 목록의 어떤 키도 seed로 hash가 되지 않으면 true
+    static constexpr bool lacks(uint8_t hash, uint8_t seed) {
+        return commandHash(First::name(), seed) != hash && Next::lacks(hash, seed);
+    }
+    // seed로 모든 키의 해시가 서로 다르면 true
+    static constexpr bool perfect(uint8_t seed) {
+        return Next::lacks(commandHash(First::name(), seed), seed) && Next::perfect(seed);
+    }
+    // seed부터 차례로 찾은 완전 해시 seed, 없으면 -1
+    static constexpr int16_t findSeed(int16_t seed) {
+        return seed > 0xFF ? -1 : perfect((uint8_t)seed) ? seed : findSeed(seed + 1);
+    }
+
+    template <uint8_t seed>
+    static bool dispatch(uint8_t hash, const char* param, const char* value) {
+        constexpr uint8_t firstHash = commandHash(First::name(), seed);
+        if (hash == firstHash) { // 해시가 같은 키는 하나뿐
+            if (strcmp(param, First::name()) != 0) return false;
+            First::run(value);
+            return true;
+        }
+        return Next::template dispatch<seed>(hash, param, value);
+    }
+};
+
+template <typename... Entries>
+struct CommandTable {
+    static constexpr int16_t seed = CommandList<Entries...>::findSeed(0);
+    static_assert(seed >= 0, "명령 키의 완전 해시 seed를 찾지 못했습니다 (commandHash 변경 필요)");
+
+    // param에 맞는 처리 함수를 실행, 모르는 명령이면 false
+    static bool dispatch(const char* param, const char* value) {
+        return CommandList<Entries...>::template dispatch<(uint8_t)seed>(commandHash(param, (uint8_t)seed), param, value);
+    }
+};
+
+#endif // COMMAND_TABLE_H
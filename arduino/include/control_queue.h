@@ -0,0 +1,36 @@
+#ifndef CONTROL_QUEUE_H
+#define CONTROL_QUEUE_H
+
+// ISR이나 다른 스레드에서 Task를 제어하기 위한 명령 큐 (다중 생산자, 단일 소비자)
+// Task::enable()/delay() 등은 execute()와 동시에 호출하면 안전하지 않으므로
+// 생산자는 controlPost()로 명령만 넣고, loop()가 execute() 직전에 controlDrain()으로 적용한다.
+// 크기가 고정된 링 버퍼이며 메모리를 할당하지 않는다. 가득 차면 명령을 버리고 개수를 센다.
+
+#include <stdint.h>
+#ifdef _STATIC_SCHEDULER
+#include "static_scheduler.h"
+#else
+#include <TaskSchedulerDeclarations.h>
+#endif
+
+#ifndef CONTROL_QUEUE_SIZE
+#define CONTROL_QUEUE_SIZE 8 // 큐 크기 (2의 거듭제곱, 최대 64)
+#endif
+
+// 명령 종류
+enum ControlOp {
+    CONTROL_ENABLE, // Task::enable()
+    CONTROL_DISABLE, // Task::disable()
+    CONTROL_RESTART, // Task::restart()
+    CONTROL_DELAY, // Task::delay(arg)
+    CONTROL_SIGNAL // StatusRequest::signal(arg) (_TASK_STATUS_REQUEST)
+};
+
+bool controlPost(uint8_t op, Task* task, unsigned long arg = 0); // ISR에서 호출 가능, 가득 차면 false
+#ifdef _TASK_STATUS_REQUEST
+bool controlSignal(StatusRequest* request, int status = 0);
+#endif
+uint8_t controlDrain(); // 쌓인 명령 적용, 적용한 개수 반환 (loop()에서만 호출)
+unsigned long controlDropped(); // 큐가 가득 차서 버린 명령 수
+
+#endif // CONTROL_QUEUE_H
@@ -0,0 +1,31 @@
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+// 바이너리 프레임 인코더/디코더 (COBS + CRC-8)
+// 프레임 = COBS(메시지 + CRC-8) + 0x00
+// - COBS: 메시지 안의 0x00을 없애므로 0x00이 프레임 끝 표시가 되고, 중간에 끊기거나 깨진 바이트가
+//   들어와도 다음 0x00에서 바로 다시 맞춰진다. 254바이트 이하 메시지는 1바이트만 늘어남.
+// - CRC-8: 다항식 0x07, 초기값 0x00에 최종 XOR FRAME_CRC_XOR. 메시지의 CRC와 마지막 바이트가 같으면 정상.
+//   최종 XOR이 없으면 CRC가 0x00인 메시지(256개 중 1개)는 CRC가 COBS 블록 끝의 0x00이 되어,
+//   코드 바이트 1비트 오류로 프레임이 그 앞에서 잘려도 남은 앞부분의 CRC가 맞아 통과한다.
+//   FRAME_CRC_XOR이 CRC 바이트 변환의 고정점(0x00, 0xFD)이 아니면 이렇게 잘린 프레임은 항상 거부된다.
+// - 메시지 길이는 opcode마다 정해져 있으므로 받는 쪽은 protocolMessageValid()로도 확인한다 (serial_protocol.h).
+// p5/sketch.js의 frameEncode()/frameDecode()/frameCrc8()과 같은 형식이다.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FRAME_CRC_XOR 0x55 // CRC 최종 XOR
+
+#define FRAME_SIZE(messageLength) ((messageLength) + 3) // CRC, COBS 코드, 0x00 포함 (메시지 254바이트 이하)
+
+uint8_t frameCrc8(const uint8_t* data, size_t length); // 최종 XOR 전의 CRC
+
+// message를 프레임으로 만들어 out에 쓰고 0x00까지 포함한 길이를 반환 (out은 FRAME_SIZE(length) 이상)
+size_t frameEncode(const uint8_t* message, size_t length, uint8_t* out);
+
+// 0x00을 뺀 프레임을 message에 풀고 메시지 길이를 반환 (COBS 오류, CRC 불일치, 빈 메시지면 0)
+// message는 length 바이트 이상
+size_t frameDecode(const uint8_t* frame, size_t length, uint8_t* message);
+
+#endif // FRAME_CODEC_H
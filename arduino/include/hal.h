@@ -0,0 +1,80 @@
+#ifndef HAL_H
+#define HAL_H
+
+// 하드웨어 추상화 계층 (HAL)
+// main.cpp는 핀, ADC, 인터럽트, 시리얼을 이 인터페이스로만 사용한다.
+// - Arduino 빌드: src/hal_arduino.cpp (analogWrite, attachInterrupt, Serial 등)
+// - native 빌드: src/hal_native.cpp (메모리 기반 스텁, _TASK_EXTERNAL_TIME 시계)
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+
+#define HAL_RISING RISING
+#define HAL_FALLING FALLING
+#define HAL_CHANGE CHANGE
+#define HAL_SERIAL_TX_SIZE SERIAL_TX_BUFFER_SIZE // HardwareSerial 송신 버퍼 크기
+#else
+#define A0 14 // Uno와 같은 아날로그 핀 번호 사용
+
+#define HAL_RISING 3
+#define HAL_FALLING 2
+#define HAL_CHANGE 1
+#define HAL_SERIAL_TX_SIZE 64
+#endif
+
+typedef void (*HalIsr)(); // 인터럽트 핸들러 타입
+
+// 핀
+void halPinInput(uint8_t pin); // 입력 핀 설정
+void halPinInputPullup(uint8_t pin); // 입력 핀 설정 (내부 풀업 저항 사용)
+void halPwmBegin(uint8_t pin); // PWM 출력 핀 설정 (Uno 9, 10, 11번은 타이머 비교 출력을 미리 연결)
+void halPwmWrite(uint8_t pin, uint8_t value); // PWM 출력 (0~255, halPwmBegin()한 핀)
+
+// ADC
+int halAnalogRead(uint8_t pin); // 아날로그 값 읽기 (0~1023)
+
+// 인터럽트 (외부 인터럽트 핀이 아니면 PinChangeInterrupt 사용)
+void halAttachInterrupt(uint8_t pin, HalIsr isr, uint8_t mode);
+
+// 시간
+uint32_t halMillis();
+uint32_t halMicros();
+uint64_t halMillis64(); // 롤오버 없는 millis (Arduino: 49.7일 안에 한 번 이상 호출해야 함, ISR에서 호출 금지)
+
+// 시리얼
+void halSerialBegin(unsigned long baud);
+int halSerialAvailable(); // 수신 버퍼의 바이트 수
+int halSerialRead(); // 1바이트 읽기, 없으면 -1
+void halSerialWrite(const uint8_t* data, size_t length); // 바이너리 송신
+int halSerialWritable(); // 블로킹 없이 송신할 수 있는 바이트 수 (송신 버퍼가 비면 HAL_SERIAL_TX_SIZE - 1)
+void halSerialPrint(const char* text);
+void halSerialPrint(long value);
+void halSerialPrint(unsigned long value);
+void halSerialPrintln(const char* text);
+void halSerialPrintln(long value);
+void halSerialPrintln(unsigned long value);
+
+inline void halSerialPrint(int value) { halSerialPrint((long)value); }
+inline void halSerialPrintln(int value) { halSerialPrintln((long)value); }
+
+#ifndef ARDUINO
+// native 빌드 전용: 하드웨어 입력을 흉내내기 위한 함수
+void halNativeSetAnalog(uint8_t pin, int value); // 가변저항 값 설정
+void halNativeTrigger(uint8_t pin); // 버튼 인터럽트 발생
+uint8_t halNativePwm(uint8_t pin); // 마지막 PWM 출력 값
+void halNativeSerialInject(const char* text); // 시리얼 수신 버퍼에 데이터 추가
+void halNativeSerialEcho(bool enabled); // 송신 데이터 표준 출력 여부
+unsigned long halNativeSerialLines(); // 지금까지 송신한 줄 수
+
+// native 빌드 전용: 시계
+void halNativeStartClock(); // 실제 시간 기준점 설정
+void halNativeUseVirtualClock(uint64_t startMicros); // 가상 시계로 전환 (시뮬레이션)
+void halNativeAdvanceClock(uint64_t micros); // 가상 시계 진행
+uint64_t halNativeClockMicros(); // 현재 시각 (64비트, 롤오버 없음)
+#endif
+
+#endif // HAL_H
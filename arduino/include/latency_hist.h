@@ -0,0 +1,35 @@
+#ifndef LATENCY_HIST_H
+#define LATENCY_HIST_H
+
+// Task별 지연 히스토그램 (_TASK_TIMECRITICAL + LATENCY_HISTOGRAM)
+// TaskScheduler의 getStartDelay()/getOverrun()은 마지막 값만 알려주므로
+// 매 실행마다 값을 log2 구간에 누적해서 p50/p99 등을 볼 수 있게 한다.
+// 구간 0: 0, 구간 b(b>=1): 2^(b-1) ~ 2^b-1, 마지막 구간은 그 이상 전부
+
+#include <stdint.h>
+
+#if defined(LATENCY_HISTOGRAM) && !defined(_TASK_TIMECRITICAL)
+#error "LATENCY_HISTOGRAM은 _TASK_TIMECRITICAL과 함께 사용해야 합니다"
+#endif
+
+#define LATENCY_BUCKETS 12 // 구간 수 (마지막 구간: 1024 이상)
+
+struct LatencyHistogram {
+    uint16_t counts[LATENCY_BUCKETS]; // 구간별 횟수 (65535에서 멈춤)
+    unsigned long maxValue; // 지금까지의 최대값
+};
+
+struct TaskLatency {
+    const char* name; // 출력용 Task 이름
+    LatencyHistogram startDelay; // 예정 시각 대비 실행 지연 (ms)
+    LatencyHistogram overrun; // 일정보다 늦어진 정도, getOverrun()이 음수일 때만 (ms)
+    LatencyHistogram execution; // 콜백 실행 시간 (us)
+};
+
+void latencyRecord(TaskLatency& latency, long startDelay, long overrun, unsigned long executionMicros);
+void latencyReset(TaskLatency& latency);
+unsigned long latencyCount(const LatencyHistogram& histogram); // 기록된 횟수
+unsigned long latencyPercentile(const LatencyHistogram& histogram, uint8_t percent); // 해당 구간의 상한값
+void latencyPrint(const TaskLatency& latency); // 시리얼로 출력 (히스토그램당 한 줄)
+
+#endif // LATENCY_HIST_H
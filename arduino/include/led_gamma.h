@@ -0,0 +1,48 @@
+#ifndef LED_GAMMA_H
+#define LED_GAMMA_H
+
+// LED 밝기 -> PWM 값 변환 (지각 선형 밝기)
+// 눈이 느끼는 밝기(CIE 1931 L*)는 PWM 듀티에 비례하지 않으므로(듀티 50%가 L* 약 76),
+// 0~255 밝기를 L* 0~100으로 보고 그 L*가 나오는 듀티를 표로 만든다.
+// 표는 constexpr 함수로 컴파일 타임에 계산하고 Arduino에서는 PROGMEM(플래시)에 두어 SRAM을 쓰지 않는다.
+//
+// 사용 예:
+//   halPwmWrite(RED_PIN, ledGamma(ledScale(currentRedValue, brightness)));
+
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h> // PROGMEM, pgm_read_byte()
+#define LED_GAMMA_READ(address) pgm_read_byte(address)
+#else
+#define PROGMEM
+#define LED_GAMMA_READ(address) (*(address))
+#endif
+
+// L*(0~100) -> 상대 휘도 Y(0~1)
+constexpr double ledLuminance(double lightness) {
+    return lightness > 8.0 ? ((lightness + 16.0) / 116.0) * ((lightness + 16.0) / 116.0) * ((lightness + 16.0) / 116.0)
+                           : lightness / 903.3;
+}
+
+// 밝기(0~255) -> PWM 값(0~255), 반올림
+constexpr uint8_t ledGammaValue(unsigned level) {
+    return (uint8_t)(ledLuminance(level * 100.0 / 255.0) * 255.0 + 0.5);
+}
+
+static_assert(ledGammaValue(0) == 0 && ledGammaValue(255) == 255, "감마 표의 양 끝은 0과 255여야 합니다");
+
+extern const uint8_t ledGammaTable[256] PROGMEM; // ledGammaValue(0~255) (src/led_gamma.cpp)
+
+// 밝기(0~255) -> PWM 값
+inline uint8_t ledGamma(uint8_t level) {
+    return LED_GAMMA_READ(&ledGammaTable[level]);
+}
+
+// color * level / 255 (내림), 나눗셈 없이 계산 (0~255 범위에서 정확히 같음)
+inline uint8_t ledScale(uint8_t color, uint8_t level) {
+    uint16_t product = (uint16_t)color * level;
+    return (uint8_t)((product + 1 + (product >> 8)) >> 8);
+}
+
+#endif // LED_GAMMA_H
@@ -0,0 +1,17 @@
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+// native 빌드용 최소 Arduino.h
+// TaskScheduler.h가 <Arduino.h>를 포함하고 millis()/micros()를 직접 호출하므로
+// 여기서 _TASK_EXTERNAL_TIME 시계(src/hal_native.cpp)로 연결한다.
+
+#include <stddef.h>
+#include <stdint.h>
+
+uint32_t external_millis();
+uint32_t external_micros();
+
+inline unsigned long millis() { return external_millis(); }
+inline unsigned long micros() { return external_micros(); }
+
+#endif // NATIVE_ARDUINO_H
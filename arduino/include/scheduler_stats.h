@@ -0,0 +1,31 @@
+#ifndef SCHEDULER_STATS_H
+#define SCHEDULER_STATS_H
+
+// 스케줄러 구간 통계 (SCHEDULER_STATS)
+// getInvokedTasks() 등은 execute()가 pass마다 다시 계산하므로 마지막 pass만 보여준다.
+// loop()가 pass마다 결과와 실행 시간을 넘기면 STATS_WINDOW_MICROS 구간 단위로 누적하고,
+// STATS: 명령은 마지막으로 끝난 구간을 한 줄로 출력한다. TaskScheduler와 _STATIC_SCHEDULER 공통.
+// 예: "STATS:pass/s=102 idle=50.9% task/s=150 maxpass=1840us load=3.7%"
+//   load: Task를 실행한 pass의 시간 합 / 구간 길이
+
+#include <stdint.h>
+
+#ifndef STATS_WINDOW_MICROS
+#define STATS_WINDOW_MICROS 1000000UL // 통계 구간 길이 (us)
+#endif
+
+struct SchedulerStats {
+    unsigned long passes; // execute() 호출 수
+    unsigned long idlePasses; // 실행한 Task가 없는 pass 수
+    unsigned long invokedTasks; // 실행한 Task 수
+    unsigned long busyMicros; // Task를 실행한 pass의 시간 합
+    unsigned long maxPassMicros; // 가장 긴 pass
+    unsigned long windowMicros; // 구간 길이 (0: 아직 끝난 구간 없음)
+};
+
+// pass 한 번 기록 (start, end: pass 앞뒤의 halMicros())
+void statsPass(bool idle, unsigned long invokedTasks, unsigned long start, unsigned long end);
+const SchedulerStats& statsLast(); // 마지막으로 끝난 구간
+void statsPrint(); // 시리얼로 출력 (STATS: 명령)
+
+#endif // SCHEDULER_STATS_H
@@ -0,0 +1,19 @@
+#ifndef SERIAL_LINE_H
+#define SERIAL_LINE_H
+
+// 줄 단위 시리얼 수신 (블로킹 없음, 동적 할당 없음)
+// Stream::readBytesUntil()은 개행이 올 때까지 Stream 타임아웃(1초)만큼 기다리므로 그동안 모든 Task가 멈춘다.
+// serialLineRead()는 수신 링 버퍼(HardwareSerial)에 이미 도착한 바이트만 꺼내 고정 크기 줄 버퍼에 모으고,
+// 개행으로 끝난 줄이 완성됐을 때만 돌려준다. 나머지 바이트는 다음 호출에서 이어서 모은다.
+// 줄 버퍼보다 긴 줄은 다음 개행까지 버린다 (잘린 명령을 실행하지 않음).
+//
+// 사용 예:
+//   char* line;
+//   while (serialLineRead(line)) handleLine(line);
+
+#define SERIAL_LINE_SIZE 32 // 줄 버퍼 크기 (널 문자 포함)
+
+// 완성된 줄이 있으면 line에 넣고 true (개행 제외, 널 종료, 다음 호출 전까지 유효)
+bool serialLineRead(char*& line);
+
+#endif // SERIAL_LINE_H
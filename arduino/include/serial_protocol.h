@@ -0,0 +1,85 @@
+#ifndef SERIAL_PROTOCOL_H
+#define SERIAL_PROTOCOL_H
+
+// 시리얼 상태 보고와 명령 수신 (텍스트 / 바이너리 프레임)
+// 기본은 줄 단위 텍스트 프로토콜이다 ("RED", "MODE:NORMAL", "Brightness: 123" ...).
+// 호스트가 PROTO:BIN 을 보내면 장치는 텍스트로 "PROTO:BIN"을 답한 뒤 양방향 모두 바이너리 프레임으로 바꾼다.
+// 바이너리에서는 COMMAND 메시지로 PROTO:TEXT 를 보내면 TEXT 메시지로 "PROTO:TEXT"를 답한 뒤 텍스트로 돌아간다.
+// 프레임 형식은 include/frame_codec.h (COBS + CRC-8), 메시지의 첫 바이트가 opcode:
+//   장치 -> 호스트                                          텍스트 모드의 같은 출력
+//     PROTOCOL_LIGHTS     [켜진 LED 비트]                   "RED", "ALL_LEDs_OFF", "BLINKING_ALL_ON" ...
+//     PROTOCOL_MODE       [모드 0~3]                        "MODE:NORMAL" ...
+//     PROTOCOL_BRIGHTNESS [0~255]                           "Brightness: 123"
+//     PROTOCOL_DURATION   [LED 비트][ms, uint32 LE]         "RED_DURATION:3000"
+//     PROTOCOL_TEXT       [ASCII]                           그 밖의 한 줄 ("TASK_REJECTED" 등)
+//   호스트 -> 장치 (텍스트 명령 줄로 바꿔 같은 명령 처리로 넘김)
+//     PROTOCOL_SET_MODE     [모드 0~3]                      "MODE:NORMAL" ...
+//     PROTOCOL_SET_DURATION [LED 비트][ms, uint32 LE]       "RED:3000"
+//     PROTOCOL_COMMAND      [ASCII 명령 한 줄]              "PROTO:TEXT" 등
+// 상태 보고는 바로 출력하지 않고 송신 큐(include/serial_tx.h)에 넣으며, 송신 Task가 protocolDrain()으로 보낸다.
+// HIST/STATS/TRACE/TXQ 출력은 halSerialPrint()로 직접 출력하므로 텍스트 모드에서만 사용한다 (바이너리 모드에서는 INVALID_VALUE).
+// p5/sketch.js가 같은 형식의 인코더/디코더를 가진다.
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 장치 -> 호스트 opcode
+#define PROTOCOL_LIGHTS 0x01
+#define PROTOCOL_MODE 0x02
+#define PROTOCOL_BRIGHTNESS 0x03
+#define PROTOCOL_DURATION 0x04
+#define PROTOCOL_TEXT 0x05
+
+// 호스트 -> 장치 opcode
+#define PROTOCOL_SET_MODE 0x81
+#define PROTOCOL_SET_DURATION 0x82
+#define PROTOCOL_COMMAND 0x83
+
+// LED 비트 (LIGHTS, DURATION)
+#define PROTOCOL_RED 0x01
+#define PROTOCOL_YELLOW 0x02
+#define PROTOCOL_GREEN 0x04
+
+#define PROTOCOL_MESSAGE_SIZE 32 // 메시지 최대 길이 (opcode 포함, CRC 제외)
+
+// 받은 메시지의 길이가 opcode에 맞으면 true (모르는 opcode, 빈 TEXT/COMMAND는 false)
+// 비트 오류로 프레임이 잘리거나 어긋나 CRC가 우연히 맞아도 길이가 다르면 거부한다.
+inline bool protocolMessageValid(const uint8_t* data, size_t length) {
+    if (length == 0) return false;
+    switch (data[0]) {
+        case PROTOCOL_LIGHTS:
+        case PROTOCOL_MODE:
+        case PROTOCOL_BRIGHTNESS:
+        case PROTOCOL_SET_MODE:
+            return length == 2;
+        case PROTOCOL_DURATION:
+        case PROTOCOL_SET_DURATION:
+            return length == 6;
+        case PROTOCOL_TEXT:
+        case PROTOCOL_COMMAND:
+            return length >= 2;
+        default:
+            return false;
+    }
+}
+
+// 상태 보고 (현재 프로토콜로 송신 큐에 넣음)
+void protocolSendLights(uint8_t lights); // lights: PROTOCOL_RED | PROTOCOL_YELLOW | PROTOCOL_GREEN 조합
+void protocolSendMode(uint8_t mode); // mode: main.cpp의 Mode 값 (NORMAL, EMERGENCY, BLINKING, OFF 순)
+void protocolSendBrightness(uint8_t brightness);
+void protocolSendDuration(uint8_t light, unsigned long duration); // light: LED 비트 하나
+void protocolSendText(const char* text); // 문자열 리터럴만, 바이너리에서는 PROTOCOL_MESSAGE_SIZE - 1자까지
+
+// 송신 큐에서 송신 버퍼의 빈 자리에 들어가는 메시지만 보냄 (블로킹 없음)
+// 남은 메시지를 보내려면 송신 버퍼에서 더 빠져야 하는 바이트 수를 돌려줌 (0: 큐가 빔)
+unsigned int protocolDrain();
+
+// 수신: 완성된 명령 줄이 있으면 line에 넣고 true (블로킹 없음, 다음 호출 전까지 유효)
+// 텍스트 모드는 serialLineRead(), 바이너리 모드는 프레임을 풀어 같은 형식의 명령 줄로 바꿈
+bool protocolRead(char*& line);
+
+// 프로토콜 전환 (PROTO: 명령), 현재 프로토콜로 답한 뒤 바꿈
+void protocolSetBinary(bool binary);
+bool protocolBinary();
+
+#endif // SERIAL_PROTOCOL_H
@@ -0,0 +1,49 @@
+#ifndef SERIAL_TX_H
+#define SERIAL_TX_H
+
+// 우선순위 송신 큐 (상태 보고를 블로킹 없이 송신)
+// HardwareSerial 송신 버퍼(64바이트)가 차면 Serial.print()는 빈 자리가 날 때까지 기다리므로
+// (9600bps에서 바이트당 약 1ms) 콜백 안의 출력이 신호 전환 등 다음 Task 실행을 밀어낸다.
+// 상태 보고(serial_protocol.h)는 메시지를 이 큐에 넣고 송신 Task를 깨우기만 하며,
+// 송신 Task는 송신 버퍼의 빈 자리에 들어가는 메시지만 보낸다 (protocolDrain()).
+// - 상태 변경 (신호, 모드, 신호 시간, 텍스트): FIFO로 먼저 송신, 가득 차면 새 메시지를 버림 (dropped)
+// - 밝기: 마지막 값 하나만 보관하고 상태 변경을 모두 보내고 송신 버퍼가 빈 뒤 송신, 보내기 전 값은 덮어씀 (coalesced)
+// TXQ: 명령은 현재/최대 깊이와 버린/덮어쓴 메시지 수를 출력한다.
+// 예: "TXQ:depth=0 max=3 dropped=0 coalesced=12"
+
+#include <stdint.h>
+#ifdef _STATIC_SCHEDULER
+#include "static_scheduler.h"
+#else
+#include <TaskSchedulerDeclarations.h>
+#endif
+
+#ifndef TX_QUEUE_SIZE
+#define TX_QUEUE_SIZE 8 // 상태 변경 메시지 수 (2의 거듭제곱, 최대 128)
+#endif
+
+// 보낼 메시지 (opcode는 serial_protocol.h의 장치 -> 호스트 opcode)
+struct TxMessage {
+    uint8_t opcode;
+    bool binary; // 넣을 때의 프로토콜 (PROTO: 응답 전후 메시지가 섞이지 않도록)
+    uint8_t light; // LIGHTS: 켜진 LED 비트, MODE: 모드, BRIGHTNESS: 밝기, DURATION: LED 비트
+    unsigned long value; // DURATION: ms
+    const char* text; // TEXT: 문자열 리터럴 (보낼 때까지 유효해야 함)
+};
+
+struct TxStats {
+    uint8_t depth; // 지금 쌓인 메시지 수 (밝기 포함)
+    uint8_t maxDepth; // 최대 깊이
+    unsigned long dropped; // 큐가 가득 차서 버린 상태 변경 메시지 수
+    unsigned long coalesced; // 보내기 전에 새 값으로 덮어쓴 밝기 메시지 수
+};
+
+void txBegin(Task& drainTask); // 메시지가 들어오면 drainTask.enableIfNot()
+bool txPush(const TxMessage& message); // 상태 변경 메시지, 가득 차면 false
+void txPushBrightness(uint8_t brightness); // 밝기 (마지막 값만 유지)
+const TxMessage* txPeek(); // 다음에 보낼 메시지 (없으면 NULL, 밝기는 binary가 의미 없음)
+void txPop(); // txPeek()한 메시지를 보냈음
+const TxStats& txStats();
+void txPrint(); // 시리얼로 출력 (TXQ: 명령)
+
+#endif // SERIAL_TX_H
@@ -0,0 +1,407 @@
+#ifndef STATIC_SCHEDULER_H
+#define STATIC_SCHEDULER_H
+
+// 컴파일 타임 Task 테이블 스케줄러 (_STATIC_SCHEDULER)
+// main.cpp의 Task는 모두 컴파일 타임에 정해져 있으므로 TaskScheduler 대신
+// Task와 콜백을 템플릿 인자로 묶은 테이블을 만든다.
+// - Task에 iPrev/iNext, 콜백 포인터, Scheduler 포인터가 없음 (addTask 없음)
+// - execute()의 Task 순회가 템플릿 재귀로 펼쳐지고 콜백을 직접 호출하므로 인라인 가능
+// - main.cpp가 사용하는 TaskScheduler API(enable, disable, restart, delay, setInterval ...)만 제공
+// - 스케줄링 규칙은 TaskScheduler 기본값(TASK_SCHEDULE, 밀린 실행은 따라잡음)과 같음
+// - Task별 우선순위 지정 가능 (_TASK_PRIORITY의 Scheduler 계층 대신 단일 테이블에서 선택)
+// - _TASK_EDF: 같은 우선순위 안에서 마감 시각이 가장 이른 Task부터 실행 (Earliest Deadline First)
+//   Task마다 상대 마감 시간과 최악 실행 시간(budget)을 지정하고,
+//   활성 Task의 이용률 합(budget / 주기)이 1을 넘으면 enable()이 거부된다.
+//   reserve()한 Task는 꺼져 있어도 이용률을 차지하므로 enable()이 거부되지 않는다.
+// - TASK_TRACE: 콜백 시작/끝과 enable/disable을 trace.h 기록기에 기록
+// - Task별 timer slack: 다른 Task를 실행한 직후 slack 안에 예정된 Task를 미리 실행하여 깨어나는 횟수를 줄임
+// - _TASK_TIME64: 실행 시각을 64비트 ms(halMillis64())로 관리하여 millis 롤오버(약 49.7일)를 없앰
+//   주기, 지연, getNextRun() 같은 시간 간격은 그대로 unsigned long
+//
+// 사용 예:
+//   Task tBlink(500, TASK_FOREVER, true);
+//   Task tButton(TASK_IMMEDIATE, TASK_ONCE, false);
+//   typedef StaticTaskTable<StaticTask<tBlink, blink>, StaticTask<tButton, button, 1> > TaskTable;
+//   Scheduler runner(&TaskTable::execute);
+
+#include <stddef.h>
+#include <stdint.h>
+#include "hal.h"
+#ifdef TASK_TRACE
+#include "trace.h"
+#endif
+
+#define TASK_IMMEDIATE 0
+#define TASK_FOREVER (-1)
+#define TASK_ONCE 1
+
+#define TASK_MILLISECOND 1UL
+#define TASK_SECOND 1000UL
+#define TASK_MINUTE 60000UL
+#define TASK_HOUR 3600000UL
+
+#define TASK_NEXTRUN_NONE 0xFFFFFFFFUL // 실행 예정인 Task 없음
+
+#define TASK_UTILIZATION_FULL 1000000UL // 이용률 1 (ppm)
+
+// 스케줄러 시각 (ms)
+#ifdef _TASK_TIME64
+typedef uint64_t TaskTime;
+typedef int64_t TaskTimeDiff; // 두 시각의 차이 (부호 있음)
+
+inline TaskTime taskMillis() { return halMillis64(); }
+#else
+typedef uint32_t TaskTime; // halMillis()와 같은 폭 (host의 64비트 unsigned long에서도 32비트로 롤오버)
+typedef int32_t TaskTimeDiff;
+
+inline TaskTime taskMillis() { return halMillis(); }
+#endif
+
+class Task {
+  public:
+    // aDeadline: 실행 예정 시각부터의 상대 마감 시간 (ms, 0: 주기와 같음)
+    // aBudget: 콜백의 최악 실행 시간 (us)
+    // aDeadline, aBudget은 _TASK_EDF가 아니면 무시
+    Task(unsigned long aInterval = 0, long aIterations = 0, bool aEnable = false,
+         unsigned long aDeadline = 0, unsigned long aBudget = 0)
+        : iEnabled(false), iInterval(aInterval), iDelay(aInterval), iPreviousMillis(0),
+          iIterations(aIterations), iSetIterations(aIterations), iRunCounter(0) {
+#ifdef _TASK_EDF
+        iDeadline = aDeadline;
+        iBudget = aBudget;
+        iReserved = false;
+#else
+        (void)aDeadline;
+        (void)aBudget;
+#endif
+#ifdef TASK_TRACE
+        iId = ++lastId(); // TaskScheduler의 _TASK_WDT_IDS처럼 생성 순서대로 1부터
+#endif
+        if (aEnable) enable();
+    }
+
+    bool enable() {
+#ifdef _TASK_EDF
+        if (!iEnabled && !iReserved) { // 새로 활성화하는 Task만 이용률 확인
+            if (!admits(iInterval)) return false;
+            totalUtilization() += utilization();
+        }
+#endif
+        iRunCounter = 0;
+        iEnabled = true;
+        iDelay = iInterval;
+        iPreviousMillis = taskMillis() - iDelay; // 바로 실행
+#ifdef TASK_TRACE
+        traceRecord(TRACE_ENABLE, iId);
+#endif
+        return true;
+    }
+    bool enableIfNot() {
+        bool previousEnabled = iEnabled;
+        if (!previousEnabled) enable();
+        return previousEnabled;
+    }
+    bool enableDelayed(unsigned long aDelay = 0) {
+        if (!enable()) return false;
+        delay(aDelay);
+        return true;
+    }
+    bool restart() {
+        iIterations = iSetIterations;
+        return enable();
+    }
+    bool restartDelayed(unsigned long aDelay = 0) {
+        iIterations = iSetIterations;
+        return enableDelayed(aDelay);
+    }
+    void delay(unsigned long aDelay = 0) {
+        iDelay = aDelay ? aDelay : iInterval;
+        iPreviousMillis = taskMillis();
+    }
+    void forceNextIteration() {
+        iDelay = iInterval;
+        iPreviousMillis = taskMillis() - iDelay;
+    }
+    bool disable() {
+        bool previousEnabled = iEnabled;
+#ifdef _TASK_EDF
+        if (previousEnabled && !iReserved) totalUtilization() -= utilization();
+#endif
+#ifdef TASK_TRACE
+        if (previousEnabled) traceRecord(TRACE_DISABLE, iId);
+#endif
+        iEnabled = false;
+        return previousEnabled;
+    }
+    bool isEnabled() { return iEnabled; }
+
+    // 실행 중이거나 reserve()한 Task는 새 주기의 이용률 합이 1을 넘으면 거부하고 이전 주기를 유지 (_TASK_EDF)
+    bool setInterval(unsigned long aInterval) {
+#ifdef _TASK_EDF
+        if (counted()) {
+            if (!admits(aInterval)) return false;
+            totalUtilization() -= utilization();
+            iInterval = aInterval;
+            totalUtilization() += utilization();
+        } else {
+            iInterval = aInterval;
+        }
+#else
+        iInterval = aInterval;
+#endif
+        delay();
+        return true;
+    }
+    unsigned long getInterval() { return iInterval; }
+    void setIterations(long aIterations) {
+        iIterations = aIterations;
+        iSetIterations = aIterations;
+    }
+    long getIterations() { return iIterations; }
+    unsigned long getRunCounter() { return iRunCounter; }
+    bool isFirstIteration() { return iRunCounter <= 1; }
+    bool isLastIteration() { return iIterations == 0; }
+
+#ifdef _TASK_EDF
+    unsigned long getDeadline() { return iDeadline; }
+    unsigned long getBudget() { return iBudget; }
+    // 이용률 (ppm), 주기가 0인 Task(TASK_IMMEDIATE 단발 실행)는 0으로 계산
+    unsigned long utilization() { return utilization(iInterval); }
+    // 주기를 aInterval로 바꿔 활성화해도 이용률 합이 1을 넘지 않으면 true
+    bool admits(unsigned long aInterval) {
+        unsigned long others = totalUtilization() - (counted() ? utilization() : 0);
+        return others + utilization(aInterval) <= TASK_UTILIZATION_FULL;
+    }
+    // 꺼져 있어도 이용률을 계속 차지 (결과를 확인할 수 없는 enableIfNot()으로 켜는 Task용), 합이 1을 넘으면 false
+    bool reserve() {
+        if (iReserved) return true;
+        if (!iEnabled) {
+            if (!admits(iInterval)) return false;
+            totalUtilization() += utilization();
+        }
+        iReserved = true;
+        return true;
+    }
+    // 이번 실행의 마감 시각 (ms)
+    TaskTime deadlineMillis() { return iPreviousMillis + iDelay + (iDeadline ? iDeadline : iInterval); }
+    // 활성 Task 전체의 이용률 합 (ppm)
+    static unsigned long getUtilization() { return totalUtilization(); }
+#endif
+
+#ifdef TASK_TRACE
+    unsigned int getId() { return iId; }
+#endif
+
+    // 시각 m에 실행할 차례인지 확인한다 (일정은 바꾸지 않음).
+    // 차례가 아니면 남은 시간으로 nextRun(가장 가까운 실행까지 남은 시간)을 줄인다.
+    bool ready(TaskTime m, unsigned long& nextRun) {
+        if (!iEnabled) return false;
+        if (iIterations == 0) { // 마지막 실행이 끝난 Task
+            disable();
+            return false;
+        }
+        // millis 롤오버에 안전한 비교 (slack으로 미리 실행하면 이전 실행 시각이 m보다 뒤일 수 있음)
+        TaskTime remaining = (TaskTime)(iPreviousMillis + iDelay - m); // 실행 예정 시각까지 남은 시간
+        if ((TaskTimeDiff)remaining > 0) {
+            if (remaining < nextRun) nextRun = (unsigned long)remaining;
+            return false;
+        }
+        return true;
+    }
+
+    // 실행 한 번을 기록하고 다음 실행 일정을 정한다 (ready()가 true일 때만 호출)
+    void advance() {
+        if (iIterations > 0) iIterations = iIterations - 1;
+        iRunCounter = iRunCounter + 1;
+        iPreviousMillis = iPreviousMillis + iDelay;
+        iDelay = iInterval;
+    }
+
+  private:
+    volatile bool iEnabled;
+    volatile unsigned long iInterval; // 실행 주기
+    volatile unsigned long iDelay; // 다음 실행까지의 지연 (보통 iInterval)
+    volatile TaskTime iPreviousMillis; // 이전 실행 시각
+    volatile long iIterations; // 남은 실행 횟수, -1: 무한
+    long iSetIterations; // 처음 설정한 실행 횟수 (restart용)
+    unsigned long iRunCounter; // enable 이후 실행 횟수
+#ifdef _TASK_EDF
+    unsigned long iDeadline; // 상대 마감 시간 (ms, 0: 주기와 같음)
+    unsigned long iBudget; // 최악 실행 시간 (us)
+    bool iReserved; // reserve() 이후 꺼져 있어도 이용률 합에 포함
+
+    static unsigned long& totalUtilization() {
+        static unsigned long total = 0;
+        return total;
+    }
+    unsigned long utilization(unsigned long aInterval) { return aInterval ? iBudget * 1000UL / aInterval : 0; }
+    bool counted() { return iEnabled || iReserved; } // 이용률 합에 들어 있음
+#endif
+#ifdef TASK_TRACE
+    uint8_t iId; // trace용 Task ID
+
+    static uint8_t& lastId() {
+        static uint8_t id = 0;
+        return id;
+    }
+#endif
+};
+
+// Task 하나와 그 콜백을 묶은 테이블 항목
+// priority: 우선순위 (클수록 먼저 실행, 기본 0)
+// slack: timer slack (ms, 기본 0). 스케줄러가 다른 Task를 실행한 직후(이미 깨어 있을 때)
+//   예정 시각까지 slack 이하로 남았으면 미리 실행하여 가까운 깨어남을 합친다.
+//   다음 일정은 원래 시각 기준(TASK_SCHEDULE)이므로, setInterval()로 시각을 다시 잡는 Task에는 쓰지 않는다.
+template <Task& task, void (*callback)(), uint8_t priority = 0, unsigned long slack = 0>
+struct StaticTask {
+    static const uint8_t level = priority;
+
+    // early: slack 안에 예정된 Task까지 실행할 차례로 볼지 여부
+    static bool ready(TaskTime m, unsigned long& nextRun, bool early) {
+        if (early) return slack > 0 && task.ready(m + slack, nextRun);
+        return task.ready(m, nextRun);
+    }
+#ifdef _TASK_EDF
+    static TaskTime deadline() { return task.deadlineMillis(); }
+#endif
+    static void dispatch() {
+        task.advance();
+#ifdef TASK_TRACE
+        traceRecord(TRACE_START, task.getId());
+        callback();
+        traceRecord(TRACE_END, task.getId());
+#else
+        callback();
+#endif
+    }
+};
+
+// pass 한 번에 실행할 Task 선택 결과
+struct StaticSelection {
+    int16_t level; // 선택한 Task의 우선순위, -1: 없음
+    uint8_t index; // 테이블 안의 위치
+#ifdef _TASK_EDF
+    TaskTime deadline; // 선택한 Task의 마감 시각
+#endif
+};
+
+// 컴파일 타임 Task 테이블 (템플릿 재귀로 펼쳐짐)
+// - 우선순위가 모두 같으면 pass 한 번에 테이블 순서대로 실행할 차례인 Task를 모두 실행
+// - 우선순위가 다르거나 _TASK_EDF이면 pass 한 번에 실행할 차례인 Task 중 하나만 실행
+//   (우선순위가 가장 높은 Task, 같은 우선순위는 _TASK_EDF면 마감 시각 순, 아니면 테이블 순서).
+//   긴 콜백 하나가 끝나면 바로 다음 pass에서 다시 고르므로, 높은 우선순위 Task의 지연은 콜백 하나로 제한된다.
+template <typename... Entries>
+struct StaticTaskTable;
+
+template <>
+struct StaticTaskTable<> {
+    static const uint8_t maxLevel = 0;
+    static const uint8_t minLevel = 0xFF;
+
+    static unsigned long runAll(TaskTime m, unsigned long& nextRun, bool early) {
+        (void)m;
+        (void)nextRun;
+        (void)early;
+        return 0;
+    }
+    static void select(TaskTime m, unsigned long& nextRun, bool early, uint8_t index, StaticSelection& best) {
+        (void)m;
+        (void)nextRun;
+        (void)early;
+        (void)index;
+        (void)best;
+    }
+    static void dispatch(uint8_t index) { (void)index; }
+};
+
+template <typename First, typename... Rest>
+struct StaticTaskTable<First, Rest...> {
+    typedef StaticTaskTable<Rest...> Next;
+    static const uint8_t maxLevel = First::level > Next::maxLevel ? First::level : Next::maxLevel;
+    static const uint8_t minLevel = First::level < Next::minLevel ? First::level : Next::minLevel;
+#ifdef _TASK_EDF
+    static const bool selectOne = true;
+#else
+    static const bool selectOne = maxLevel != minLevel;
+#endif
+
+    // pass 한 번 실행, 실행한 Task 수 반환
+    static unsigned long execute(TaskTime m, unsigned long& nextRun, bool early) {
+        if (!selectOne) return runAll(m, nextRun, early);
+
+        StaticSelection best;
+        best.level = -1;
+        best.index = 0;
+        select(m, nextRun, early, 0, best);
+        if (best.level < 0) return 0;
+        dispatch(best.index);
+        return 1;
+    }
+
+    // 테이블 순서대로 실행할 차례인 Task를 모두 실행
+    static unsigned long runAll(TaskTime m, unsigned long& nextRun, bool early) {
+        unsigned long invoked = 0;
+        if (First::ready(m, nextRun, early)) {
+            First::dispatch();
+            invoked = 1;
+        }
+        return invoked + Next::runAll(m, nextRun, early);
+    }
+
+    // 실행할 차례인 Task 중 먼저 실행할 항목 찾기
+    static void select(TaskTime m, unsigned long& nextRun, bool early, uint8_t index, StaticSelection& best) {
+#ifdef _TASK_EDF
+        if ((int16_t)First::level >= best.level && First::ready(m, nextRun, early)) {
+            TaskTime deadline = First::deadline();
+            if ((int16_t)First::level > best.level || (TaskTimeDiff)(deadline - best.deadline) < 0) { // 롤오버에 안전한 비교
+                best.level = First::level;
+                best.index = index;
+                best.deadline = deadline;
+            }
+        }
+#else
+        if ((int16_t)First::level > best.level && First::ready(m, nextRun, early)) {
+            best.level = First::level;
+            best.index = index;
+        }
+#endif
+        Next::select(m, nextRun, early, index + 1, best);
+    }
+
+    static void dispatch(uint8_t index) {
+        if (index == 0) First::dispatch();
+        else Next::dispatch(index - 1);
+    }
+};
+
+class Scheduler {
+  public:
+    typedef unsigned long (*TableExecute)(TaskTime m, unsigned long& nextRun, bool early);
+
+    explicit Scheduler(TableExecute aTable) : iTable(aTable), iInvokedTasks(0), iNextRun(0), iAwake(false) {}
+
+    // 테이블 전체를 한 번 확인한다. 실행한 Task가 없으면 true (idle pass)
+    bool execute() {
+        TaskTime m = taskMillis();
+        unsigned long nextRun = TASK_NEXTRUN_NONE;
+        iInvokedTasks = iTable(m, nextRun, false);
+        if (iInvokedTasks == 0 && iAwake) { // 이미 깨어 있으면 slack 안에 예정된 Task도 미리 실행
+            unsigned long earlyNextRun = TASK_NEXTRUN_NONE;
+            iInvokedTasks = iTable(m, earlyNextRun, true);
+        }
+        iAwake = iInvokedTasks > 0;
+        iNextRun = (iInvokedTasks > 0 || nextRun == TASK_NEXTRUN_NONE) ? 0 : nextRun;
+        return iInvokedTasks == 0;
+    }
+
+    unsigned long getInvokedTasks() { return iInvokedTasks; }
+    unsigned long getNextRun() { return iNextRun; } // 다음 실행까지 남은 시간, 0: 바로 또는 알 수 없음
+
+  private:
+    TableExecute iTable;
+    unsigned long iInvokedTasks;
+    unsigned long iNextRun;
+    bool iAwake; // 직전 pass에서 Task를 실행했는지 여부
+};
+
+#endif // STATIC_SCHEDULER_H
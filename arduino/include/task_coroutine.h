@@ -0,0 +1,136 @@
+#ifndef TASK_COROUTINE_H
+#define TASK_COROUTINE_H
+
+// C++20 코루틴 Task (TASK_COROUTINE, host 전용)
+// 상태 변수와 switch 대신 코루틴 하나로 순서를 적고, Task 콜백이 resume()으로 한 단계씩 실행한다.
+//   co_await sleepFor(ms) : Task 주기를 ms로 바꾸고 다음 실행까지 대기 (setInterval()과 같음)
+//                           _TASK_EDF에서 거부되면 이전 주기로 대기하고 sleepRejected()가 true
+//   co_await request      : StatusRequest 완료까지 대기 (_TASK_STATUS_REQUEST, TaskScheduler 빌드)
+// 코루틴 프레임은 고정 크기 풀에서 할당하므로 생성과 resume 모두 힙을 사용하지 않는다.
+//
+// 사용 예:
+//   TaskCoroutine blink() { for (;;) { on(); co_await sleepFor(100); off(); co_await sleepFor(900); } }
+//   TaskCoroutine routine;
+//   void blinkCallback() { routine.resume(); }
+//   routine = blink(); routine.bind(tBlink); tBlink.enable();
+
+#ifdef TASK_COROUTINE
+
+#ifdef ARDUINO
+#error "TASK_COROUTINE은 host(native) 빌드 전용입니다 (C++20 필요)"
+#endif
+
+#include <coroutine>
+#include <stddef.h>
+
+#ifdef _STATIC_SCHEDULER
+#include "static_scheduler.h"
+#else
+#include <TaskSchedulerDeclarations.h>
+#endif
+
+#ifndef COROUTINE_FRAME_SIZE
+#define COROUTINE_FRAME_SIZE 256 // 코루틴 프레임 최대 크기 (바이트)
+#endif
+#ifndef COROUTINE_FRAME_COUNT
+#define COROUTINE_FRAME_COUNT 4 // 동시에 존재할 수 있는 코루틴 수 (재시작 시 잠시 2개)
+#endif
+
+void* coroutineFrameAlloc(size_t size); // 풀에서 프레임 할당, 크기 초과나 풀 부족이면 종료
+void coroutineFrameFree(void* frame);
+[[noreturn]] void coroutineUnhandledException(); // 코루틴 안에서 빠져나온 예외, 프레임 풀 오류처럼 종료
+
+// co_await sleepFor(ms)
+struct SleepFor {
+    unsigned long ms;
+};
+
+inline SleepFor sleepFor(unsigned long ms) {
+    return SleepFor{ ms };
+}
+
+class TaskCoroutine {
+  public:
+    struct promise_type {
+        Task* task = nullptr; // 이 코루틴을 실행하는 Task
+        bool sleepRejected = false; // 마지막 sleepFor()의 setInterval()이 거부됨 (_TASK_EDF)
+
+        TaskCoroutine get_return_object() { return TaskCoroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; } // 첫 resume()부터 실행
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { coroutineUnhandledException(); } // 삼키면 코루틴이 오류 없이 끝난 것처럼 보임
+
+        struct SleepAwaiter {
+            Task* task;
+            unsigned long ms;
+            bool await_ready() { return false; }
+            void await_suspend(std::coroutine_handle<promise_type> handle) {
+#ifdef _TASK_EDF
+                handle.promise().sleepRejected = !task->setInterval(ms);
+#else
+                (void)handle;
+                task->setInterval(ms);
+#endif
+            }
+            void await_resume() {}
+        };
+        SleepAwaiter await_transform(SleepFor sleep) { return SleepAwaiter{ task, sleep.ms }; }
+
+#if defined(_TASK_STATUS_REQUEST) && !defined(_STATIC_SCHEDULER)
+        struct StatusAwaiter {
+            Task* task;
+            StatusRequest* request;
+            bool await_ready() { return !request->pending(); }
+            void await_suspend(std::coroutine_handle<>) { task->waitFor(request, task->getInterval(), TASK_FOREVER); }
+            int await_resume() { return request->getStatus(); }
+        };
+        StatusAwaiter await_transform(StatusRequest& request) { return StatusAwaiter{ task, &request }; }
+#endif
+
+        static void* operator new(size_t size) { return coroutineFrameAlloc(size); }
+        static void operator delete(void* frame) { coroutineFrameFree(frame); }
+    };
+
+    TaskCoroutine() : iHandle(nullptr) {}
+    TaskCoroutine(TaskCoroutine&& other) : iHandle(other.iHandle) { other.iHandle = nullptr; }
+    TaskCoroutine& operator=(TaskCoroutine&& other) {
+        if (this != &other) {
+            if (iHandle) iHandle.destroy();
+            iHandle = other.iHandle;
+            other.iHandle = nullptr;
+        }
+        return *this;
+    }
+    TaskCoroutine(const TaskCoroutine&) = delete;
+    TaskCoroutine& operator=(const TaskCoroutine&) = delete;
+    ~TaskCoroutine() {
+        if (iHandle) iHandle.destroy();
+    }
+
+    // 코루틴을 실행할 Task 지정 (첫 resume() 전에 호출)
+    void bind(Task& task) {
+        if (iHandle) iHandle.promise().task = &task;
+    }
+
+    // 다음 co_await까지 실행, 코루틴이 끝났으면 false
+    bool resume() {
+        if (!iHandle || iHandle.done()) return false;
+        iHandle.resume();
+        return !iHandle.done();
+    }
+
+    bool done() { return !iHandle || iHandle.done(); }
+
+    // 마지막 resume()이 멈춘 sleepFor()의 주기 변경이 거부되었으면 true (_TASK_EDF)
+    bool sleepRejected() { return iHandle && iHandle.promise().sleepRejected; }
+
+  private:
+    explicit TaskCoroutine(std::coroutine_handle<promise_type> handle) : iHandle(handle) {}
+
+    std::coroutine_handle<promise_type> iHandle;
+};
+
+#endif // TASK_COROUTINE
+
+#endif // TASK_COROUTINE_H
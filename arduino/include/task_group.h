@@ -0,0 +1,29 @@
+#ifndef TASK_GROUP_H
+#define TASK_GROUP_H
+
+// 같은 주기의 콜백을 Task 하나로 묶는 그룹
+// 주기가 같은 Task를 따로 두면 execute()가 각각 시각을 확인하고, 위상이 어긋나면
+// 한 주기에 여러 번 깨어난다. 그룹은 타이머 하나로 멤버 콜백을 순서대로 연달아 실행한다.
+// TaskScheduler와 _STATIC_SCHEDULER 모두 run()을 일반 콜백으로 사용한다.
+//
+// 사용 예:
+//   typedef TaskGroup<readSensor, updateOutput> PeriodicGroup;
+//   Task tPeriodic(20, TASK_FOREVER, &PeriodicGroup::run, &runner, true);
+
+template <void (*... callbacks)()>
+struct TaskGroup;
+
+template <>
+struct TaskGroup<> {
+    static void run() {}
+};
+
+template <void (*first)(), void (*... rest)()>
+struct TaskGroup<first, rest...> {
+    static void run() { // 멤버 콜백을 순서대로 실행
+        first();
+        TaskGroup<rest...>::run();
+    }
+};
+
+#endif // TASK_GROUP_H
@@ -0,0 +1,81 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// 스케줄러 이벤트 기록기 (TASK_TRACE)
+// 콜백 시작/끝, enable/disable, StatusRequest 신호, idle 진입을 8바이트 레코드로
+// 고정 크기 링 버퍼에 기록한다. 버퍼가 가득 차면 가장 오래된 레코드부터 덮어쓴다.
+// - TaskScheduler 빌드: _TASK_WDT_IDS 필요 (Task ID로 기록), 콜백 래퍼와 OnEnable/OnDisable로 기록
+// - _STATIC_SCHEDULER 빌드: static_scheduler.h 안에서 직접 기록
+// 출력 형식 (한 줄에 레코드 하나): TRACE:<시각 us>,<이벤트>,<Task ID>,<인자>
+// Task 이름: TRACE:TASK,<Task ID>,<이름>
+// tools/trace_to_chrome.py 로 Chrome/Perfetto trace JSON으로 변환한다.
+
+#include <stdint.h>
+#include "hal.h"
+
+#if defined(TASK_TRACE) && !defined(_STATIC_SCHEDULER) && !defined(_TASK_WDT_IDS)
+#error "TASK_TRACE는 _TASK_WDT_IDS와 함께 사용해야 합니다 (_STATIC_SCHEDULER 제외)"
+#endif
+
+#ifndef TRACE_BUFFER_SIZE
+#ifdef ARDUINO
+#define TRACE_BUFFER_SIZE 32 // 레코드 수 (2의 거듭제곱), Uno SRAM 256바이트
+#else
+#define TRACE_BUFFER_SIZE 1024
+#endif
+#endif
+
+#define TRACE_NO_TASK 0xFF // Task와 관계없는 이벤트
+
+// 이벤트 종류
+enum TraceEvent {
+    TRACE_START, // 콜백 시작
+    TRACE_END, // 콜백 끝
+    TRACE_ENABLE, // Task 활성화
+    TRACE_DISABLE, // Task 비활성화
+    TRACE_SIGNAL, // StatusRequest 신호 (인자: 상태 값)
+    TRACE_IDLE // 실행할 Task가 없는 pass 진입 (sleep 진입 지점)
+};
+
+struct TraceRecord {
+    uint32_t time; // halMicros()
+    uint8_t event; // TraceEvent
+    uint8_t task; // Task ID
+    uint16_t arg; // 이벤트별 인자
+};
+
+extern TraceRecord traceBuffer[TRACE_BUFFER_SIZE];
+extern uint16_t traceHead; // 다음에 쓸 위치 (계속 증가, 버퍼 위치는 하위 비트)
+extern uint16_t traceTail; // 다음에 읽을 위치 (traceHead - traceTail <= TRACE_BUFFER_SIZE)
+extern unsigned long traceLostRecords; // 덮어써진 레코드 수 (최대값에서 멈춤)
+
+// 레코드 한 개 기록 (loop()/콜백에서만 호출, ISR 제외)
+// 가득 차면 가장 오래된 레코드를 덮어쓰면서 바로 세므로 덤프 사이에 레코드가 아무리 많아도 traceLost()가 맞다.
+inline void traceRecord(uint8_t event, uint8_t task, uint16_t arg = 0) {
+    if ((uint16_t)(traceHead - traceTail) == TRACE_BUFFER_SIZE) {
+        traceTail++;
+        if (traceLostRecords != 0xFFFFFFFFUL) traceLostRecords++;
+    }
+    TraceRecord& record = traceBuffer[traceHead & (TRACE_BUFFER_SIZE - 1)];
+    record.time = halMicros();
+    record.event = event;
+    record.task = task;
+    record.arg = arg;
+    traceHead++;
+}
+
+// execute() 결과로 idle 진입 기록 (idle pass가 이어지면 첫 번째만 기록)
+inline void traceIdle(bool idle) {
+    static bool wasIdle = false;
+    if (idle && !wasIdle) traceRecord(TRACE_IDLE, TRACE_NO_TASK);
+    wasIdle = idle;
+}
+
+bool traceRead(TraceRecord& record); // 가장 오래된 레코드 꺼내기, 없으면 false
+unsigned long traceLost(); // 읽기 전에 덮어써진 레코드 수
+void traceDump(); // Task 이름 목록과 쌓인 레코드를 시리얼로 출력
+
+extern const char* const traceTaskNames[]; // Task ID 순 이름 목록 (main.cpp)
+extern const uint8_t traceTaskCount;
+
+#endif // TRACE_H
@@ -0,0 +1,142 @@
+#include "control_queue.h"
+#include "trace.h"
+
+#ifdef ARDUINO_ARCH_AVR
+#include <Arduino.h>
+#endif
+
+// 슬롯마다 순번(sequence)을 두는 bounded 링 버퍼
+// - 생산자: head를 CAS로 한 칸 예약한 뒤 명령을 쓰고 순번을 pos+1로 갱신
+// - 소비자: 순번이 pos+1인 슬롯만 읽고, 순번을 pos+SIZE로 돌려 다음 바퀴에 재사용
+struct ControlSlot {
+    volatile uint8_t sequence;
+    uint8_t op;
+    void* target; // Task* 또는 StatusRequest*
+    unsigned long arg;
+};
+
+static ControlSlot slots[CONTROL_QUEUE_SIZE];
+static volatile uint8_t head = 0; // 생산자가 다음에 예약할 위치
+static uint8_t tail = 0; // 소비자가 다음에 읽을 위치
+static volatile unsigned long dropped = 0;
+
+// 슬롯 i의 첫 순번은 i (전역 생성자에서 설정, setup()에서 인터럽트를 붙이기 전)
+static struct ControlQueueInit {
+    ControlQueueInit() {
+        for (uint8_t i = 0; i < CONTROL_QUEUE_SIZE; i++) slots[i].sequence = i;
+    }
+} controlQueueInit;
+
+#ifdef ARDUINO_ARCH_AVR
+// AVR은 단일 코어이고 CAS 명령이 없다. ISR끼리는 중첩되지 않으므로
+// 일반 코드에서 호출될 때만 비교-교환하는 몇 사이클 동안 인터럽트를 막는다.
+// 메모리 장벽: op/target/arg는 volatile이 아니므로 컴파일러가 순번 확인 앞이나 순번 저장 뒤로 옮기지 못하게 한다.
+#define COMPILER_BARRIER() __asm__ __volatile__("" ::: "memory")
+#define LOAD_ACQUIRE(x) ({ __typeof__(x) loaded = (x); COMPILER_BARRIER(); loaded; })
+#define STORE_RELEASE(x, v) do { COMPILER_BARRIER(); (x) = (v); } while (0)
+
+static bool casHead(uint8_t expected, uint8_t desired) {
+    uint8_t sreg = SREG;
+    cli();
+    bool swapped = head == expected;
+    if (swapped) head = desired;
+    SREG = sreg;
+    return swapped;
+}
+
+// 4바이트 read-modify-write이므로 일반 코드의 post()를 ISR의 post()가 끼어들어도 개수를 잃지 않게 한다.
+static void countDropped() {
+    uint8_t sreg = SREG;
+    cli();
+    dropped = dropped + 1;
+    SREG = sreg;
+}
+
+static unsigned long loadDropped() {
+    uint8_t sreg = SREG;
+    cli();
+    unsigned long value = dropped;
+    SREG = sreg;
+    return value;
+}
+#else
+#define LOAD_ACQUIRE(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+static bool casHead(uint8_t expected, uint8_t desired) {
+    return __atomic_compare_exchange_n(&head, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+static void countDropped() {
+    __atomic_fetch_add(&dropped, 1UL, __ATOMIC_RELAXED);
+}
+
+static unsigned long loadDropped() {
+    return __atomic_load_n(&dropped, __ATOMIC_RELAXED);
+}
+#endif
+
+static bool post(uint8_t op, void* target, unsigned long arg) {
+    uint8_t pos = LOAD_ACQUIRE(head);
+    for (;;) {
+        ControlSlot& slot = slots[pos & (CONTROL_QUEUE_SIZE - 1)];
+        int8_t diff = (int8_t)(LOAD_ACQUIRE(slot.sequence) - pos);
+        if (diff == 0) {
+            if (casHead(pos, pos + 1)) { // 슬롯 예약 성공
+                slot.op = op;
+                slot.target = target;
+                slot.arg = arg;
+                STORE_RELEASE(slot.sequence, (uint8_t)(pos + 1));
+                return true;
+            }
+            pos = LOAD_ACQUIRE(head);
+        } else if (diff < 0) { // 가득 참
+            countDropped();
+            return false;
+        } else { // 다른 생산자가 먼저 예약함
+            pos = LOAD_ACQUIRE(head);
+        }
+    }
+}
+
+bool controlPost(uint8_t op, Task* task, unsigned long arg) {
+    return post(op, task, arg);
+}
+
+#ifdef _TASK_STATUS_REQUEST
+bool controlSignal(StatusRequest* request, int status) {
+    return post(CONTROL_SIGNAL, request, (unsigned long)status);
+}
+#endif
+
+uint8_t controlDrain() {
+    uint8_t count = 0;
+    for (;;) {
+        ControlSlot& slot = slots[tail & (CONTROL_QUEUE_SIZE - 1)];
+        if ((int8_t)(LOAD_ACQUIRE(slot.sequence) - (uint8_t)(tail + 1)) < 0) break; // 비어 있음
+
+        Task* task = (Task*)slot.target;
+        switch (slot.op) {
+            case CONTROL_ENABLE: task->enable(); break;
+            case CONTROL_DISABLE: task->disable(); break;
+            case CONTROL_RESTART: task->restart(); break;
+            case CONTROL_DELAY: task->delay(slot.arg); break;
+#ifdef _TASK_STATUS_REQUEST
+            case CONTROL_SIGNAL:
+                ((StatusRequest*)slot.target)->signal((int)slot.arg);
+#ifdef TASK_TRACE
+                traceRecord(TRACE_SIGNAL, TRACE_NO_TASK, (uint16_t)slot.arg);
+#endif
+                break;
+#endif
+        }
+        STORE_RELEASE(slot.sequence, (uint8_t)(tail + CONTROL_QUEUE_SIZE));
+        tail++;
+        count++;
+    }
+    return count;
+}
+
+unsigned long controlDropped() {
+    return loadDropped();
+}
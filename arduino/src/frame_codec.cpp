@@ -0,0 +1,55 @@
+#include "frame_codec.h"
+
+uint8_t frameCrc8(const uint8_t* data, size_t length) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+size_t frameEncode(const uint8_t* message, size_t length, uint8_t* out) {
+    uint8_t crc = frameCrc8(message, length) ^ FRAME_CRC_XOR;
+    size_t codeIndex = 0; // 현재 블록의 코드 바이트 위치
+    size_t index = 1;
+    uint8_t code = 1; // 다음 0x00까지의 거리
+    for (size_t i = 0; i <= length; i++) { // 마지막 바이트는 CRC
+        uint8_t value = i < length ? message[i] : crc;
+        if (value == 0) {
+            out[codeIndex] = code;
+            codeIndex = index++;
+            code = 1;
+        } else {
+            out[index++] = value;
+            if (++code == 0xFF) { // 0x00 없이 254바이트인 블록
+                out[codeIndex] = code;
+                codeIndex = index++;
+                code = 1;
+            }
+        }
+    }
+    out[codeIndex] = code;
+    out[index++] = 0; // 프레임 끝
+    return index;
+}
+
+size_t frameDecode(const uint8_t* frame, size_t length, uint8_t* message) {
+    size_t index = 0;
+    size_t decoded = 0;
+    while (index < length) {
+        uint8_t code = frame[index++];
+        if (code == 0) return 0;
+        for (uint8_t i = 1; i < code; i++) {
+            if (index >= length || frame[index] == 0) return 0; // 블록이 잘림
+            message[decoded++] = frame[index++];
+        }
+        if (code < 0xFF && index < length) message[decoded++] = 0; // 블록 사이의 0x00
+    }
+    if (decoded < 2) return 0; // opcode와 CRC는 있어야 함
+    decoded--;
+    if ((uint8_t)(frameCrc8(message, decoded) ^ FRAME_CRC_XOR) != message[decoded]) return 0;
+    return decoded;
+}
@@ -0,0 +1,113 @@
+#ifdef ARDUINO
+
+#include "hal.h"
+#include "PinChangeInterrupt.h"
+
+void halPinInput(uint8_t pin) {
+    pinMode(pin, INPUT);
+}
+
+void halPinInputPullup(uint8_t pin) {
+    pinMode(pin, INPUT_PULLUP);
+}
+
+void halPwmBegin(uint8_t pin) {
+    pinMode(pin, OUTPUT);
+#if defined(__AVR_ATmega328P__)
+    // Uno의 Timer1, Timer2는 위상 교정 PWM이라 OCR 0은 항상 LOW, 255는 항상 HIGH
+    // 비교 출력을 한 번만 연결해 두고 halPwmWrite()는 OCR만 바꾼다.
+    switch (pin) {
+        case 9: OCR1A = 0; TCCR1A |= _BV(COM1A1); return;
+        case 10: OCR1B = 0; TCCR1A |= _BV(COM1B1); return;
+        case 11: OCR2A = 0; TCCR2A |= _BV(COM2A1); return;
+    }
+#endif
+    analogWrite(pin, 0);
+}
+
+void halPwmWrite(uint8_t pin, uint8_t value) {
+#if defined(__AVR_ATmega328P__)
+    // analogWrite()의 핀 -> 타이머 표 조회(PROGMEM)와 0/255 digitalWrite() 분기 없이 비교 레지스터에 바로 씀
+    switch (pin) {
+        case 9: OCR1A = value; return;
+        case 10: OCR1B = value; return;
+        case 11: OCR2A = value; return;
+    }
+#endif
+    analogWrite(pin, value);
+}
+
+int halAnalogRead(uint8_t pin) {
+    return analogRead(pin);
+}
+
+void halAttachInterrupt(uint8_t pin, HalIsr isr, uint8_t mode) {
+    if (digitalPinToInterrupt(pin) != NOT_AN_INTERRUPT) { // 외부 인터럽트 핀 (Uno: 2, 3)
+        attachInterrupt(digitalPinToInterrupt(pin), isr, mode);
+    } else { // 나머지 핀은 PinChangeInterrupt 라이브러리 사용
+        attachPCINT(digitalPinToPCINT(pin), isr, mode);
+    }
+}
+
+uint32_t halMillis() {
+    return millis();
+}
+
+uint32_t halMicros() {
+    return micros();
+}
+
+uint64_t halMillis64() {
+    static uint32_t last = 0; // 직전에 읽은 millis()
+    static uint32_t wraps = 0; // millis() 롤오버 횟수
+    uint32_t now = millis();
+    if (now < last) wraps++;
+    last = now;
+    return ((uint64_t)wraps << 32) | now;
+}
+
+void halSerialBegin(unsigned long baud) {
+    Serial.begin(baud);
+}
+
+int halSerialAvailable() {
+    return Serial.available();
+}
+
+int halSerialRead() {
+    return Serial.read();
+}
+
+void halSerialWrite(const uint8_t* data, size_t length) {
+    Serial.write(data, length);
+}
+
+int halSerialWritable() {
+    return Serial.availableForWrite();
+}
+
+void halSerialPrint(const char* text) {
+    Serial.print(text);
+}
+
+void halSerialPrint(long value) {
+    Serial.print(value);
+}
+
+void halSerialPrint(unsigned long value) {
+    Serial.print(value);
+}
+
+void halSerialPrintln(const char* text) {
+    Serial.println(text);
+}
+
+void halSerialPrintln(long value) {
+    Serial.println(value);
+}
+
+void halSerialPrintln(unsigned long value) {
+    Serial.println(value);
+}
+
+#endif // ARDUINO
@@ -0,0 +1,192 @@
+#ifndef ARDUINO
+
+// native(x86 Linux) 빌드용 HAL 구현
+// - 핀/ADC: 메모리 배열에 값 저장
+// - 시리얼: 메모리 수신 버퍼 + 표준 출력
+// - 시간: _TASK_EXTERNAL_TIME 용 external_millis()/external_micros()
+//   실제 시간(CLOCK_MONOTONIC) 또는 시뮬레이션용 가상 시계
+// 실행 진입점(main)은 src/main_native.cpp
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "hal.h"
+
+#define NATIVE_PIN_COUNT 20 // Uno 핀 수 (D0~D13, A0~A5)
+#define NATIVE_RX_SIZE 256 // 시리얼 수신 버퍼 크기
+
+static uint8_t pwmValues[NATIVE_PIN_COUNT]; // PWM 출력 값
+static int analogValues[NATIVE_PIN_COUNT]; // 아날로그 입력 값
+static HalIsr isrTable[NATIVE_PIN_COUNT]; // 핀별 인터럽트 핸들러
+
+static char rxBuffer[NATIVE_RX_SIZE]; // 시리얼 수신 링 버퍼
+static size_t rxHead = 0; // 다음에 쓸 위치
+static size_t rxTail = 0; // 다음에 읽을 위치
+
+static bool serialEcho = true; // 송신 데이터를 표준 출력으로 내보낼지 여부
+static unsigned long txLines = 0; // 송신한 줄 수
+
+static struct timespec startTime; // 프로그램 시작 시각
+static bool clockStarted = false; // 시작 전에는 Arduino처럼 0을 반환 (전역 Task 생성자 대비)
+static bool virtualClock = false; // 가상 시계 사용 여부
+static uint64_t virtualMicros = 0; // 가상 시계 현재 시각
+
+// 시간
+static uint64_t elapsedMicros() {
+    if (virtualClock) return virtualMicros;
+    if (!clockStarted) return 0;
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)((int64_t)(now.tv_sec - startTime.tv_sec) * 1000000
+        + (int64_t)(now.tv_nsec - startTime.tv_nsec) / 1000);
+}
+
+void halNativeStartClock() {
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+    clockStarted = true;
+}
+
+void halNativeUseVirtualClock(uint64_t startMicros) {
+    virtualClock = true;
+    virtualMicros = startMicros;
+}
+
+void halNativeAdvanceClock(uint64_t micros) {
+    virtualMicros += micros;
+}
+
+uint64_t halNativeClockMicros() {
+    return elapsedMicros();
+}
+
+uint32_t external_millis() {
+    return (uint32_t)(elapsedMicros() / 1000);
+}
+
+uint32_t external_micros() {
+    return (uint32_t)elapsedMicros();
+}
+
+uint32_t halMillis() {
+    return external_millis();
+}
+
+uint32_t halMicros() {
+    return external_micros();
+}
+
+uint64_t halMillis64() {
+    return elapsedMicros() / 1000;
+}
+
+// 핀
+void halPinInput(uint8_t pin) {
+    (void)pin;
+}
+
+void halPinInputPullup(uint8_t pin) {
+    (void)pin;
+}
+
+void halPwmBegin(uint8_t pin) {
+    if (pin < NATIVE_PIN_COUNT) pwmValues[pin] = 0;
+}
+
+void halPwmWrite(uint8_t pin, uint8_t value) {
+    if (pin < NATIVE_PIN_COUNT) pwmValues[pin] = value;
+}
+
+int halAnalogRead(uint8_t pin) {
+    return pin < NATIVE_PIN_COUNT ? analogValues[pin] : 0;
+}
+
+void halAttachInterrupt(uint8_t pin, HalIsr isr, uint8_t mode) {
+    (void)mode; // 버튼 한 번 = 에지 한 번으로 취급
+    if (pin < NATIVE_PIN_COUNT) isrTable[pin] = isr;
+}
+
+void halNativeSetAnalog(uint8_t pin, int value) {
+    if (pin < NATIVE_PIN_COUNT) analogValues[pin] = value;
+}
+
+void halNativeTrigger(uint8_t pin) {
+    if (pin < NATIVE_PIN_COUNT && isrTable[pin]) isrTable[pin]();
+}
+
+uint8_t halNativePwm(uint8_t pin) {
+    return pin < NATIVE_PIN_COUNT ? pwmValues[pin] : 0;
+}
+
+// 시리얼
+void halSerialBegin(unsigned long baud) {
+    (void)baud;
+    setvbuf(stdout, NULL, _IOLBF, 0); // 줄 단위로 출력
+}
+
+int halSerialAvailable() {
+    return (int)((rxHead + NATIVE_RX_SIZE - rxTail) % NATIVE_RX_SIZE);
+}
+
+int halSerialRead() {
+    if (rxHead == rxTail) return -1;
+    char c = rxBuffer[rxTail];
+    rxTail = (rxTail + 1) % NATIVE_RX_SIZE;
+    return (unsigned char)c;
+}
+
+void halNativeSerialInject(const char* text) {
+    for (; *text; text++) {
+        size_t next = (rxHead + 1) % NATIVE_RX_SIZE;
+        if (next == rxTail) return; // 버퍼가 가득 차면 버림 (HardwareSerial과 동일)
+        rxBuffer[rxHead] = *text;
+        rxHead = next;
+    }
+}
+
+void halNativeSerialEcho(bool enabled) {
+    serialEcho = enabled;
+}
+
+unsigned long halNativeSerialLines() {
+    return txLines;
+}
+
+int halSerialWritable() {
+    return HAL_SERIAL_TX_SIZE - 1; // 표준 출력은 막히지 않으므로 송신 버퍼가 항상 비어 있는 것으로 봄
+}
+
+void halSerialWrite(const uint8_t* data, size_t length) {
+    txLines++; // 프레임 하나를 한 줄로 셈
+    if (serialEcho) fwrite(data, 1, length, stdout);
+}
+
+void halSerialPrint(const char* text) {
+    if (serialEcho) fputs(text, stdout);
+}
+
+void halSerialPrint(long value) {
+    if (serialEcho) printf("%ld", value);
+}
+
+void halSerialPrint(unsigned long value) {
+    if (serialEcho) printf("%lu", value);
+}
+
+void halSerialPrintln(const char* text) {
+    txLines++;
+    if (serialEcho) printf("%s\n", text);
+}
+
+void halSerialPrintln(long value) {
+    txLines++;
+    if (serialEcho) printf("%ld\n", value);
+}
+
+void halSerialPrintln(unsigned long value) {
+    txLines++;
+    if (serialEcho) printf("%lu\n", value);
+}
+
+#endif // ARDUINO
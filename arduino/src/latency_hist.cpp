@@ -0,0 +1,91 @@
+#ifdef LATENCY_HISTOGRAM
+
+#include "latency_hist.h"
+#include "hal.h"
+
+// 값이 속한 구간 번호
+static uint8_t bucketOf(unsigned long value) {
+    uint8_t bucket = 0;
+    while (value > 0 && bucket < LATENCY_BUCKETS - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// 구간의 상한값
+static unsigned long bucketLimit(uint8_t bucket) {
+    return bucket == 0 ? 0 : (1UL << bucket) - 1;
+}
+
+static void histogramRecord(LatencyHistogram& histogram, unsigned long value) {
+    uint16_t& count = histogram.counts[bucketOf(value)];
+    if (count < 0xFFFF) count++;
+    if (value > histogram.maxValue) histogram.maxValue = value;
+}
+
+void latencyRecord(TaskLatency& latency, long startDelay, long overrun, unsigned long executionMicros) {
+    histogramRecord(latency.startDelay, startDelay > 0 ? startDelay : 0);
+    histogramRecord(latency.overrun, overrun < 0 ? -overrun : 0);
+    histogramRecord(latency.execution, executionMicros);
+}
+
+void latencyReset(TaskLatency& latency) {
+    const char* name = latency.name;
+    latency = TaskLatency();
+    latency.name = name;
+}
+
+unsigned long latencyCount(const LatencyHistogram& histogram) {
+    unsigned long total = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) total += histogram.counts[i];
+    return total;
+}
+
+unsigned long latencyPercentile(const LatencyHistogram& histogram, uint8_t percent) {
+    unsigned long total = latencyCount(histogram);
+    if (total == 0) return 0;
+
+    unsigned long target = (total * percent + 99) / 100; // 올림
+    unsigned long seen = 0;
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += histogram.counts[i];
+        if (seen >= target) {
+            unsigned long limit = bucketLimit(i);
+            return i == LATENCY_BUCKETS - 1 || limit > histogram.maxValue ? histogram.maxValue : limit;
+        }
+    }
+    return histogram.maxValue;
+}
+
+// 예: "HIST:tNormal:start n=120 p50=0 p90=1 p99=3 max=3 b=100,12,8,0,..."
+static void histogramPrint(const char* name, const char* kind, const LatencyHistogram& histogram) {
+    halSerialPrint("HIST:");
+    halSerialPrint(name);
+    halSerialPrint(":");
+    halSerialPrint(kind);
+    halSerialPrint(" n=");
+    halSerialPrint(latencyCount(histogram));
+    halSerialPrint(" p50=");
+    halSerialPrint(latencyPercentile(histogram, 50));
+    halSerialPrint(" p90=");
+    halSerialPrint(latencyPercentile(histogram, 90));
+    halSerialPrint(" p99=");
+    halSerialPrint(latencyPercentile(histogram, 99));
+    halSerialPrint(" max=");
+    halSerialPrint(histogram.maxValue);
+    halSerialPrint(" b=");
+    for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+        if (i > 0) halSerialPrint(",");
+        halSerialPrint((unsigned long)histogram.counts[i]);
+    }
+    halSerialPrintln("");
+}
+
+void latencyPrint(const TaskLatency& latency) {
+    histogramPrint(latency.name, "start", latency.startDelay);
+    histogramPrint(latency.name, "overrun", latency.overrun);
+    histogramPrint(latency.name, "exec", latency.execution);
+}
+
+#endif // LATENCY_HISTOGRAM
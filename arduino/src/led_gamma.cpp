@@ -0,0 +1,10 @@
+#include "led_gamma.h"
+
+// 템플릿 정적 멤버는 comdat 섹션으로 가서 PROGMEM이 무시될 수 있으므로 일반 배열을 매크로로 펼친다.
+#define LED_GAMMA_4(level) ledGammaValue(level), ledGammaValue(level + 1), ledGammaValue(level + 2), ledGammaValue(level + 3)
+#define LED_GAMMA_16(level) LED_GAMMA_4(level), LED_GAMMA_4(level + 4), LED_GAMMA_4(level + 8), LED_GAMMA_4(level + 12)
+#define LED_GAMMA_64(level) LED_GAMMA_16(level), LED_GAMMA_16(level + 16), LED_GAMMA_16(level + 32), LED_GAMMA_16(level + 48)
+
+const uint8_t ledGammaTable[256] PROGMEM = {
+    LED_GAMMA_64(0), LED_GAMMA_64(64), LED_GAMMA_64(128), LED_GAMMA_64(192)
+};
@@ -1,6 +1,20 @@
-#include <Arduino.h>
+#include <string.h>
+#ifdef _STATIC_SCHEDULER
+#include "static_scheduler.h"
+#else
 #include <TaskScheduler.h>
-#include "PinChangeInterrupt.h"
+#endif
+#include "hal.h"
+#include "led_gamma.h"
+#include "latency_hist.h"
+#include "scheduler_stats.h"
+#include "serial_protocol.h"
+#include "serial_tx.h"
+#include "command_table.h"
+#include "control_queue.h"
+#include "trace.h"
+#include "task_coroutine.h"
+#include "task_group.h"
 
 // 핀 번호 정의
 #define RED_PIN 9  // RED_LED를 위한 PWM 핀
@@ -13,6 +27,8 @@
 
 #define POTENTIOMETER_PIN A0 // 밝기 조절을 위한 가변저항이 연결된 핀
 #define SERIAL_BAUDRATE 9600 // 시리얼 통신 속도
+#define SERIAL_BYTE_MICROS (10000000UL / SERIAL_BAUDRATE) // 바이트 하나가 선로를 떠나는 시간 (시작/정지 비트 포함 10비트)
+#define TX_DRAIN_INTERVAL 5 // 시리얼 송신 Task 주기 (ms, 송신 버퍼가 찼을 때는 남은 메시지가 들어갈 자리가 날 때까지 미룸)
 
 // 모드 정의
 enum Mode {
@@ -33,6 +49,7 @@ unsigned long greenDuration = 2000; // GREEN_LED가 켜져있는 시간 2초
 int currentRedValue = 0; // 현재 RED_LED 색상 값
 int currentYellowValue = 0; // 현재 YELLOW_LED 색상 값
 int currentGreenValue = 0; // 현재 GREEN_LED 색상 값
+bool ledsDirty = true; // 색상이나 밝기가 바뀌어 LED 출력을 다시 써야 함
 
 // 버튼 눌림 여부
 volatile bool emergencyButtonPressed = false; // 비상모드 버튼 눌림 여부
@@ -46,44 +63,205 @@ void checkButtons(); // 버튼 체크 함수
 void readPotentiometer(); // 가변저항 값 읽기 함수
 void processSerial(); // 시리얼 입력 처리 함수
 void updateLEDs(); // LED 업데이트 함수
+void drainSerial(); // 시리얼 송신 큐 처리 함수
 
+extern Task tButtons; // 버튼 처리 Task (아래에서 생성)
+
+// ISR은 눌린 버튼을 표시하고 제어 큐로 tButtons 재시작을 요청한다.
+// loop()가 다음 pass 직전에 큐를 비우므로 20ms 주기 확인을 기다리지 않는다.
 void emergencyISR() { // 비상모드 버튼 눌림 ISR
     emergencyButtonPressed = true;
+    controlPost(CONTROL_RESTART, &tButtons);
 }
 void blinkingISR() { // 깜박임모드 버튼 눌림 ISR
     blinkingButtonPressed = true;
+    controlPost(CONTROL_RESTART, &tButtons);
 }
 void toggleISR() { // ON/OFF 토글 버튼 눌림 ISR
     toggleButtonPressed = true;
+    controlPost(CONTROL_RESTART, &tButtons);
 }
 
+#ifdef _STATIC_SCHEDULER
+#ifdef LATENCY_HISTOGRAM
+#error "LATENCY_HISTOGRAM은 TaskScheduler(_TASK_TIMECRITICAL)가 필요합니다 (_STATIC_SCHEDULER와 함께 사용 불가)"
+#endif
+
+// Task 객체 생성 (콜백은 아래 Task 테이블에서 연결)
+// 뒤의 두 값은 _TASK_EDF용 상대 마감 시간(ms, 0: 주기)과 최악 실행 시간(us)
+// 최악 실행 시간은 Uno에서 측정하지 않은 추정치
+// 실제 값은 TaskScheduler 빌드의 -DLATENCY_HISTOGRAM에서 HIST:ALL의 실행 시간 최대 구간으로 정한다.
+Task tNormal(redDuration, TASK_FOREVER, false, 5, 1500); // 일반모드 Task (신호 전환은 5ms 안에)
+Task tBlinking(500, TASK_FOREVER, false, 5, 1500); // 깜박임모드 Task
+
+Task tButtons(TASK_IMMEDIATE, TASK_ONCE, false, 10, 4000); // 버튼 처리 Task (ISR이 재시작)
+Task tPeriodic(20, TASK_FOREVER, false, 0, 3500); // 20ms 주기 Task 그룹 (가변저항, 시리얼, LED)
+Task tSerialTx(TX_DRAIN_INTERVAL, TASK_FOREVER, false, 0, 600); // 시리얼 송신 큐 Task (메시지가 들어오면 시작)
+
+// 20ms 주기 콜백을 한 타이머로 연달아 실행
+typedef TaskGroup<readPotentiometer, processSerial, updateLEDs> PeriodicGroup;
+
+#ifndef PERIODIC_SLACK
+#define PERIODIC_SLACK 0 // 20ms 그룹의 timer slack (ms), 신호 시퀀스가 깨어날 때 함께 실행
+#endif
+
+// 컴파일 타임 Task 테이블 (같은 우선순위는 TaskScheduler의 addTask 순서와 같은 실행 순서)
+// 우선순위: 버튼 처리 > 신호 시퀀스 > 20ms 주기 그룹, 송신 큐
+typedef StaticTaskTable<
+    StaticTask<tNormal, normalSequence, 1>,
+    StaticTask<tBlinking, blinkingSequence, 1>,
+    StaticTask<tButtons, checkButtons, 2>,
+    StaticTask<tPeriodic, PeriodicGroup::run, 0, PERIODIC_SLACK>,
+    StaticTask<tSerialTx, drainSerial, 0>
+> TaskTable;
+
+// 스케줄러 객체 생성
+Scheduler runner(&TaskTable::execute);
+#else
+#ifdef _TASK_TIME64
+#error "_TASK_TIME64는 _STATIC_SCHEDULER 전용입니다 (TaskScheduler는 32비트 시각 사용)"
+#endif
+
 // TaskScheduler 객체 생성
 Scheduler runner;
 
+#ifdef LATENCY_HISTOGRAM
+// Task별 지연 히스토그램 (HIST:ALL 명령으로 출력)
+TaskLatency normalLatency = { "tNormal", {}, {}, {} };
+TaskLatency blinkingLatency = { "tBlinking", {}, {}, {} };
+TaskLatency buttonsLatency = { "tButtons", {}, {}, {} };
+TaskLatency potentiometerLatency = { "tPotentiometer", {}, {}, {} };
+TaskLatency serialLatency = { "tSerial", {}, {}, {} };
+TaskLatency updateLEDsLatency = { "tUpdateLEDs", {}, {}, {} };
+TaskLatency serialTxLatency = { "tSerialTx", {}, {}, {} };
+
+TaskLatency* latencyTable[] = {
+    &normalLatency, &blinkingLatency, &buttonsLatency, &potentiometerLatency, &serialLatency, &updateLEDsLatency,
+    &serialTxLatency
+};
+
+// 콜백 실행 시간, 시작 지연, overrun을 히스토그램에 기록하는 래퍼
+template <void (*callback)(), TaskLatency& latency>
+void measured() {
+    Task* task = runner.getCurrentTask();
+    unsigned long start = halMicros();
+    callback();
+    latencyRecord(latency, task->getStartDelay(), task->getOverrun(), halMicros() - start);
+}
+#endif // LATENCY_HISTOGRAM
+
+#ifdef TASK_TRACE
+// 콜백 시작/끝을 trace에 기록하는 래퍼 (Task ID는 _TASK_WDT_IDS가 생성 순서대로 부여)
+template <void (*callback)()>
+void traced() {
+    uint8_t id = runner.getCurrentTask()->getId();
+    traceRecord(TRACE_START, id);
+    callback();
+    traceRecord(TRACE_END, id);
+}
+
+// enable()/disable()에서 TaskScheduler가 getCurrentTask()를 해당 Task로 바꾼 뒤 호출
+bool traceOnEnable() {
+    traceRecord(TRACE_ENABLE, runner.getCurrentTask()->getId());
+    return true;
+}
+void traceOnDisable() {
+    traceRecord(TRACE_DISABLE, runner.getCurrentTask()->getId());
+}
+#define TASK_TRACED(callback) traced<callback>
+#else
+#define TASK_TRACED(callback) callback
+#endif // TASK_TRACE
+
+#ifdef LATENCY_HISTOGRAM
+#define TASK_MEASURED(callback, latency) measured<callback, latency>
+#else
+#define TASK_MEASURED(callback, latency) callback
+#endif // LATENCY_HISTOGRAM
+
+#define TASK_CALLBACK(callback, latency) (&TASK_TRACED(TASK_MEASURED(callback, latency)))
+
+// 20ms 주기 콜백을 한 타이머로 연달아 실행 (히스토그램은 멤버별로 기록)
+typedef TaskGroup<
+    TASK_MEASURED(readPotentiometer, potentiometerLatency),
+    TASK_MEASURED(processSerial, serialLatency),
+    TASK_MEASURED(updateLEDs, updateLEDsLatency)
+> PeriodicGroup;
+
 // Task 객체 생성
-Task tNormal(redDuration, TASK_FOREVER, &normalSequence, &runner, false); // 일반모드 Task
-Task tBlinking(500, TASK_FOREVER, &blinkingSequence, &runner, false); // 깜박임모드 Task
+Task tNormal(redDuration, TASK_FOREVER, TASK_CALLBACK(normalSequence, normalLatency), &runner, false); // 일반모드 Task
+Task tBlinking(500, TASK_FOREVER, TASK_CALLBACK(blinkingSequence, blinkingLatency), &runner, false); // 깜박임모드 Task
 
-Task tButtons(20, TASK_FOREVER, &checkButtons, &runner, true); // 버튼 체크 Task
-Task tPotentiometer(20, TASK_FOREVER, &readPotentiometer, &runner, true); // 가변저항 값 읽기 Task
-Task tSerial(20, TASK_FOREVER, &processSerial, &runner, true); // 시리얼 입력 처리 Task
-Task tUpdateLEDs(20, TASK_FOREVER, &updateLEDs, &runner, true); // LED 업데이트 Task
+Task tButtons(TASK_IMMEDIATE, TASK_ONCE, TASK_CALLBACK(checkButtons, buttonsLatency), &runner, false); // 버튼 처리 Task (ISR이 재시작)
+Task tPeriodic(20, TASK_FOREVER, &TASK_TRACED(PeriodicGroup::run), &runner, false); // 20ms 주기 Task 그룹 (가변저항, 시리얼, LED)
+Task tSerialTx(TX_DRAIN_INTERVAL, TASK_FOREVER, TASK_CALLBACK(drainSerial, serialTxLatency), &runner, false); // 시리얼 송신 큐 Task (메시지가 들어오면 시작)
+#endif // _STATIC_SCHEDULER
+
+#ifdef TASK_TRACE
+// trace 출력용 Task 이름 (Task ID 순, 위 Task 생성 순서와 같아야 함)
+const char* const traceTaskNames[] = {
+    "", "tNormal", "tBlinking", "tButtons", "tPeriodic", "tSerialTx"
+};
+const uint8_t traceTaskCount = sizeof(traceTaskNames) / sizeof(traceTaskNames[0]);
+#endif // TASK_TRACE
 
 // LED 색상 설정 함수 (내부 상태만 변경)
 void setLEDColors(int r, int y, int g) {
     currentRedValue = r;
     currentYellowValue = y;
     currentGreenValue = g;
+    ledsDirty = true;
 }
 
-// LED 업데이트 함수 (실제 하드웨어 제어)
+// LED 업데이트 함수 (실제 하드웨어 제어), 색상이나 밝기가 바뀐 뒤에만 출력
 void updateLEDs() {
-    // 밝기 적용하여 LED 제어
-    analogWrite(RED_PIN, currentRedValue * brightness / 255);
-    analogWrite(YELLOW_PIN, currentYellowValue * brightness / 255);
-    analogWrite(GREEN_PIN, currentGreenValue * brightness / 255);
+    if (!ledsDirty) return; // PWM 출력은 다시 쓰지 않아도 유지됨
+    ledsDirty = false;
+    // 밝기 적용 후 감마 표로 지각 선형 밝기의 PWM 값으로 변환 (include/led_gamma.h)
+    halPwmWrite(RED_PIN, ledGamma(ledScale(currentRedValue, brightness)));
+    halPwmWrite(YELLOW_PIN, ledGamma(ledScale(currentYellowValue, brightness)));
+    halPwmWrite(GREEN_PIN, ledGamma(ledScale(currentGreenValue, brightness)));
 }
 
+#ifdef TASK_COROUTINE
+// 일반모드 시퀀스 코루틴 (RED -> YELLOW -> GREEN -> Blinking Green -> YELLOW)
+TaskCoroutine normalCoroutine() {
+    for (;;) {
+        setLEDColors(255, 0, 0);
+        protocolSendLights(PROTOCOL_RED);
+        co_await sleepFor(redDuration);
+
+        setLEDColors(0, 255, 0);
+        protocolSendLights(PROTOCOL_YELLOW);
+        co_await sleepFor(yellowDuration);
+
+        setLEDColors(0, 0, 255);
+        protocolSendLights(PROTOCOL_GREEN);
+        co_await sleepFor(greenDuration);
+
+        for (int blinkCount = 0; blinkCount < 3; blinkCount++) { // Blinking Green (3Hz)
+            setLEDColors(0, 0, 0);
+            protocolSendLights(0);
+            co_await sleepFor(166);
+            setLEDColors(0, 0, 255);
+            protocolSendLights(PROTOCOL_GREEN);
+            co_await sleepFor(166);
+        }
+
+        setLEDColors(0, 255, 0);
+        protocolSendLights(PROTOCOL_YELLOW);
+        co_await sleepFor(yellowDuration);
+    }
+}
+
+TaskCoroutine normalRoutine; // 실행 중인 일반모드 코루틴 (setMode(NORMAL)에서 새로 시작)
+
+// 일반모드 시퀀스 함수 정의, 코루틴을 다음 co_await까지 실행
+void normalSequence() {
+    normalRoutine.resume();
+    if (normalRoutine.sleepRejected()) protocolSendText("TASK_REJECTED"); // _TASK_EDF 이용률 초과, 이전 주기 유지
+}
+#else
 // 일반모드 시퀀스 상태 변수
 int normalState = 0; // 일반모드 상태
 // 0: RED
@@ -92,25 +270,34 @@ int normalState = 0; // 일반모드 상태
 // 3: Blinking Green
 // 4: Yellow
 
+// 다음 단계까지의 시간 설정, _TASK_EDF 이용률 초과로 거부되면 이전 주기를 유지하고 알림
+void setNormalInterval(unsigned long interval) {
+#ifdef _TASK_EDF
+    if (!tNormal.setInterval(interval)) protocolSendText("TASK_REJECTED");
+#else
+    tNormal.setInterval(interval);
+#endif
+}
+
 // 일반모드 시퀀스 함수 정의 (RED -> YELLOW -> GREEN -> Blinking Green -> YELLOW)
 void normalSequence(){
     switch (normalState) {
         case 0: // RED
             setLEDColors(255, 0, 0);
-            Serial.println("RED");
-            tNormal.setInterval(redDuration);
+            protocolSendLights(PROTOCOL_RED);
+            setNormalInterval(redDuration);
             normalState = 1;
             break;
         case 1: // YELLOW
             setLEDColors(0, 255, 0);
-            Serial.println("YELLOW");
-            tNormal.setInterval(yellowDuration);
+            protocolSendLights(PROTOCOL_YELLOW);
+            setNormalInterval(yellowDuration);
             normalState = 2;            
             break;
         case 2: // GREEN
             setLEDColors(0, 0, 255);
-            Serial.println("GREEN");
-            tNormal.setInterval(greenDuration);
+            protocolSendLights(PROTOCOL_GREEN);
+            setNormalInterval(greenDuration);
             normalState = 3;            
             break;
         case 3: // Blinking Green (3Hz)
@@ -119,12 +306,12 @@ void normalSequence(){
 
             if(blinkState){
                 setLEDColors(0, 0, 255);
-                Serial.println("GREEN");
+                protocolSendLights(PROTOCOL_GREEN);
                 blinkState = false;
                 blinkCount++;
             } else {
                 setLEDColors(0, 0, 0);
-                Serial.println("ALL_LEDs_OFF");
+                protocolSendLights(0);
                 blinkState = true;
             }
 
@@ -132,27 +319,29 @@ void normalSequence(){
                 blinkCount = 0;
                 normalState = 4;
             } else {
-                tNormal.setInterval(166);
+                setNormalInterval(166);
             }
             break;
         case 4: // Yellow
             setLEDColors(0, 255, 0);
-            Serial.println("YELLOW");
-            tNormal.setInterval(yellowDuration);
+            protocolSendLights(PROTOCOL_YELLOW);
+            setNormalInterval(yellowDuration);
             normalState = 0;            
             break;
     }
 }
 
+#endif // TASK_COROUTINE
+
 // 깜박임모드 시퀀스 함수 정의
 void blinkingSequence(){
     static bool blinkAllState = false;
     if(blinkAllState){
         setLEDColors(255, 255, 255);
-        Serial.println("BLINKING_ALL_ON");
+        protocolSendLights(PROTOCOL_RED | PROTOCOL_YELLOW | PROTOCOL_GREEN);
     } else {
         setLEDColors(0, 0, 0);
-        Serial.println("ALL_LEDs_OFF");
+        protocolSendLights(0);
     }
     blinkAllState = !blinkAllState;
 }
@@ -166,23 +355,28 @@ void setMode(Mode newMode){
     // 새 모드 설정
     switch (newMode) {
         case NORMAL:
+#ifdef TASK_COROUTINE
+            normalRoutine = normalCoroutine(); // 처음(RED)부터 다시 시작
+            normalRoutine.bind(tNormal);
+#else
             normalState = 0; // 일반모드 상태 초기화
-            tNormal.enable();
-            Serial.println("MODE:NORMAL");
+#endif
+            if (!tNormal.enable()) protocolSendText("TASK_REJECTED"); // _TASK_EDF 이용률 초과
+            protocolSendMode(NORMAL);
             break;
         case EMERGENCY:
             setLEDColors(255, 0, 0); // 비상모드에서 RED_LED 켜기
-            Serial.println("MODE:EMERGENCY");
-            Serial.println("RED");
+            protocolSendMode(EMERGENCY);
+            protocolSendLights(PROTOCOL_RED);
             break;
         case BLINKING:
-            tBlinking.enable();
-            Serial.println("MODE:BLINKING");
+            if (!tBlinking.enable()) protocolSendText("TASK_REJECTED");
+            protocolSendMode(BLINKING);
             break;
         case OFF:
             setLEDColors(0, 0, 0);
-            Serial.println("MODE:OFF");
-            Serial.println("ALL_LEDs_OFF");
+            protocolSendMode(OFF);
+            protocolSendLights(0);
             break;
     }
     currentMode = newMode;
@@ -191,7 +385,7 @@ void setMode(Mode newMode){
 // 버튼 체크 함수, 버튼 눌림 여부에 따라 모드 변경
 void checkButtons() {
     if (emergencyButtonPressed) { // 비상모드 버튼 눌림
-        Serial.println("Emergency button pressed"); 
+        protocolSendText("Emergency button pressed"); 
         if(currentMode == EMERGENCY) { 
             setMode(NORMAL); // 비상모드에서 일반모드로 전환
         } else {
@@ -200,7 +394,7 @@ void checkButtons() {
       emergencyButtonPressed = false; 
     }
     if (blinkingButtonPressed) { // 깜박임모드 버튼 눌림
-        Serial.println("Blinking button pressed");
+        protocolSendText("Blinking button pressed");
         if(currentMode == BLINKING) { 
             setMode(NORMAL); // 깜박임모드에서 일반모드로 전환
         } else {
@@ -209,7 +403,7 @@ void checkButtons() {
       blinkingButtonPressed = false;
     }
     if (toggleButtonPressed) { // ON/OFF 토글 버튼 눌림
-        Serial.println("ON/OFF button pressed");
+        protocolSendText("ON/OFF button pressed");
         if (currentMode == OFF) {
             setMode(NORMAL); // OFF 상태에서 일반모드로 전환
         } else {
@@ -221,78 +415,197 @@ void checkButtons() {
 
 // 가변저항 값 읽기
 void readPotentiometer(){ 
-    int potValue = analogRead(POTENTIOMETER_PIN); // 가변저항 값 읽기
-    int newBrightness = map(potValue, 0, 1023, 0, 255); // 0~1023 -> 0~255로 변환
+    int potValue = halAnalogRead(POTENTIOMETER_PIN); // 가변저항 값 읽기
+    int newBrightness = (long)potValue * 255 / 1023; // 0~1023 -> 0~255로 변환
     
     // 값이 변경된 경우에만 업데이트 및 출력
     if (abs(newBrightness - brightness) > 2) { // 작은 변화는 무시 (노이즈 방지)
         brightness = newBrightness;
-        Serial.print("Brightness: ");
-        Serial.println(brightness);
+        ledsDirty = true;
+        protocolSendBrightness(brightness);
     }
 }
 
-// 시리얼 입력 처리
-void processSerial() {
-    if (Serial.available() > 0) {
-      String command = Serial.readStringUntil('\n'); // 개행 문자까지 읽기
-      command.trim(); // 앞뒤 공백 제거
-      int separatorPos = command.indexOf(':'); // : 위치 찾기
-      if (separatorPos > 0) { // : 문자가 있는 경우
-        String param = command.substring(0, separatorPos); // : 앞부분
-        String value = command.substring(separatorPos + 1); // : 뒷부분
-        
-        if (param == "RED") {
-          redDuration = value.toInt(); // 문자열을 정수로 변환 후 저장
-          Serial.print("RED_DURATION:");
-          Serial.println(redDuration);
-        } 
-        else if (param == "YELLOW") { 
-          yellowDuration = value.toInt();
-          Serial.print("YELLOW_DURATION:");
-          Serial.println(yellowDuration);
-        } 
-        else if (param == "GREEN") {
-          greenDuration = value.toInt();
-          Serial.print("GREEN_DURATION:");
-          Serial.println(greenDuration);
-        }
-        else if (param == "MODE") {
-          if (value == "NORMAL") setMode(NORMAL);
-          else if (value == "EMERGENCY") setMode(EMERGENCY);
-          else if (value == "BLINKING") setMode(BLINKING);
-          else if (value == "OFF") setMode(OFF);
-        }
-      }
+// 문자열 앞뒤 공백 제거 (버퍼 안에서 처리)
+char* trimLine(char* text) {
+    while (*text == ' ' || *text == '\t' || *text == '\r') text++; // 앞부분 공백 건너뛰기
+    size_t length = strlen(text);
+    while (length > 0 && (text[length - 1] == ' ' || text[length - 1] == '\t' || text[length - 1] == '\r')) {
+        text[--length] = '\0'; // 뒷부분 공백 제거
+    }
+    return text;
+}
+
+// 신호 시간 명령 (RED:<ms>, YELLOW:<ms>, GREEN:<ms>), 숫자가 아니면 값을 바꾸지 않음
+void setDuration(unsigned long& duration, uint8_t light, const char* value) {
+    unsigned long parsed;
+    if (!commandParseUnsigned(value, parsed)) {
+        protocolSendText("INVALID_VALUE");
+        return;
+    }
+#ifdef _TASK_EDF
+    if (!tNormal.admits(parsed)) { // 이 주기로는 이용률 합이 1을 넘음 (예약한 tSerialTx 포함, 단계 시작 때도 같은 합)
+        protocolSendText("TASK_REJECTED");
+        return;
+    }
+#endif
+    duration = parsed;
+    protocolSendDuration(light, duration); // 예: RED_DURATION:3000
+}
+
+void redCommand(const char* value) { setDuration(redDuration, PROTOCOL_RED, value); }
+void yellowCommand(const char* value) { setDuration(yellowDuration, PROTOCOL_YELLOW, value); }
+void greenCommand(const char* value) { setDuration(greenDuration, PROTOCOL_GREEN, value); }
+
+void modeCommand(const char* value) { // MODE:NORMAL|EMERGENCY|BLINKING|OFF
+    if (strcmp(value, "NORMAL") == 0) setMode(NORMAL);
+    else if (strcmp(value, "EMERGENCY") == 0) setMode(EMERGENCY);
+    else if (strcmp(value, "BLINKING") == 0) setMode(BLINKING);
+    else if (strcmp(value, "OFF") == 0) setMode(OFF);
+}
+
+void protoCommand(const char* value) { // PROTO:BIN 바이너리 프레임, PROTO:TEXT 텍스트 (include/serial_protocol.h)
+    if (strcmp(value, "BIN") == 0) protocolSetBinary(true);
+    else if (strcmp(value, "TEXT") == 0) protocolSetBinary(false);
+    else protocolSendText("INVALID_VALUE");
+}
+
+// 출력 명령(TXQ, HIST, STATS, TRACE)은 halSerialPrint()로 바로 쓰므로 바이너리 모드에서는 프레임이 깨지지 않게 거부
+bool textOutputAllowed() {
+    if (!protocolBinary()) return true;
+    protocolSendText("INVALID_VALUE");
+    return false;
+}
+
+void txqCommand(const char* value) { // TXQ: 송신 큐 깊이와 버린 메시지 수 출력
+    (void)value;
+    if (textOutputAllowed()) txPrint();
+}
+
+#ifdef LATENCY_HISTOGRAM
+void histCommand(const char* value) { // HIST:ALL 출력, HIST:RESET 초기화
+    if (strcmp(value, "RESET") != 0 && !textOutputAllowed()) return;
+    for (size_t i = 0; i < sizeof(latencyTable) / sizeof(latencyTable[0]); i++) {
+        if (strcmp(value, "RESET") == 0) latencyReset(*latencyTable[i]);
+        else latencyPrint(*latencyTable[i]);
     }
 }
+#endif // LATENCY_HISTOGRAM
+
+#ifdef SCHEDULER_STATS
+void statsCommand(const char* value) { // STATS: 마지막 1초 구간 통계 출력
+    (void)value;
+    if (textOutputAllowed()) statsPrint();
+}
+#endif // SCHEDULER_STATS
+
+#ifdef TASK_TRACE
+void traceCommand(const char* value) { // TRACE:DUMP 쌓인 레코드 출력
+    if (strcmp(value, "DUMP") == 0 && textOutputAllowed()) traceDump();
+}
+#endif // TASK_TRACE
+
+// 시리얼 명령 표 (PARAM -> 처리 함수, 컴파일 타임 완전 해시)
+constexpr char RED_KEY[] = "RED";
+constexpr char YELLOW_KEY[] = "YELLOW";
+constexpr char GREEN_KEY[] = "GREEN";
+constexpr char MODE_KEY[] = "MODE";
+constexpr char PROTO_KEY[] = "PROTO";
+constexpr char TXQ_KEY[] = "TXQ";
+constexpr char HIST_KEY[] = "HIST";
+constexpr char STATS_KEY[] = "STATS";
+constexpr char TRACE_KEY[] = "TRACE";
+
+typedef CommandTable<
+    CommandEntry<RED_KEY, redCommand>,
+    CommandEntry<YELLOW_KEY, yellowCommand>,
+    CommandEntry<GREEN_KEY, greenCommand>,
+#ifdef LATENCY_HISTOGRAM
+    CommandEntry<HIST_KEY, histCommand>,
+#endif
+#ifdef SCHEDULER_STATS
+    CommandEntry<STATS_KEY, statsCommand>,
+#endif
+#ifdef TASK_TRACE
+    CommandEntry<TRACE_KEY, traceCommand>,
+#endif
+    CommandEntry<PROTO_KEY, protoCommand>,
+    CommandEntry<TXQ_KEY, txqCommand>,
+    CommandEntry<MODE_KEY, modeCommand>
+> Commands;
+
+// 시리얼 명령 한 줄 처리 (PARAM:VALUE, 모르는 PARAM은 무시)
+void handleCommand(char* line) {
+    char* command = trimLine(line); // 앞뒤 공백 제거
+    char* separator = strchr(command, ':'); // : 위치 찾기
+    if (separator != NULL && separator != command) { // : 문자가 있는 경우
+        *separator = '\0';
+        Commands::dispatch(command, separator + 1); // : 앞부분으로 처리 함수 선택, 뒷부분은 값
+    }
+}
+
+// 시리얼 송신 큐 처리 (송신 버퍼가 차면 남은 메시지가 들어갈 만큼 비는 시각에 이어서 보내고, 다 보내면 Task 정지)
+void drainSerial() {
+    unsigned int waiting = protocolDrain(); // 송신 버퍼에서 더 빠져야 하는 바이트 수
+    if (waiting == 0) tSerialTx.disable();
+    else tSerialTx.delay((waiting * SERIAL_BYTE_MICROS + 999) / 1000); // 1바이트도 1ms 뒤로 (delay(0)은 주기)
+}
+
+// 시리얼 입력 처리 (도착한 바이트만 읽고, 개행 또는 프레임 끝까지 받은 명령만 실행하므로 블로킹 없음)
+void processSerial() {
+    char* line;
+    while (protocolRead(line)) handleCommand(line);
+}
 
 // 초기 설정
 void setup() {
     // 핀 모드 설정
-    pinMode(RED_PIN, OUTPUT); // RED_LED 핀을 출력으로 설정
-    pinMode(YELLOW_PIN, OUTPUT); // YELLOW_LED 핀을 출력으로 설정
-    pinMode(GREEN_PIN, OUTPUT); // GREEN_LED 핀을 출력으로 설정
-    pinMode(BUTTON_EMERGENCY, INPUT_PULLUP); // 비상모드 버튼 핀을 입력으로 설정 (풀업 저항 사용)
-    pinMode(BUTTON_BLINKING, INPUT_PULLUP); // 깜박임모드 버튼 핀을 입력으로 설정 (풀업 저항 사용)
-    pinMode(BUTTON_TOGGLE, INPUT_PULLUP); // ON/OFF 토글 버튼 핀을 입력으로 설정 (풀업 저항 사용)
-    pinMode(POTENTIOMETER_PIN, INPUT); // 가변저항 핀을 입력으로 설정
-
-    // 인터럽트 설정
-    attachInterrupt(digitalPinToInterrupt(BUTTON_EMERGENCY), emergencyISR, RISING); // 비상모드 버튼 인터럽트 설정
-    attachInterrupt(digitalPinToInterrupt(BUTTON_BLINKING), blinkingISR, RISING); // 깜박임모드 버튼 인터럽트 설정
-    
-    // PinChangeInterrupt 라이브러리 사용하여 인터럽트 설정
-    attachPCINT(digitalPinToPCINT(BUTTON_TOGGLE), toggleISR, RISING); // ON/OFF 토글 버튼 인터럽트 설정
+    halPwmBegin(RED_PIN); // RED_LED 핀을 PWM 출력으로 설정
+    halPwmBegin(YELLOW_PIN); // YELLOW_LED 핀을 PWM 출력으로 설정
+    halPwmBegin(GREEN_PIN); // GREEN_LED 핀을 PWM 출력으로 설정
+    halPinInputPullup(BUTTON_EMERGENCY); // 비상모드 버튼 핀을 입력으로 설정 (풀업 저항 사용)
+    halPinInputPullup(BUTTON_BLINKING); // 깜박임모드 버튼 핀을 입력으로 설정 (풀업 저항 사용)
+    halPinInputPullup(BUTTON_TOGGLE); // ON/OFF 토글 버튼 핀을 입력으로 설정 (풀업 저항 사용)
+    halPinInput(POTENTIOMETER_PIN); // 가변저항 핀을 입력으로 설정
+
+    // 인터럽트 설정 (핀 4는 HAL 내부에서 PinChangeInterrupt 사용)
+    halAttachInterrupt(BUTTON_EMERGENCY, emergencyISR, HAL_RISING); // 비상모드 버튼 인터럽트 설정
+    halAttachInterrupt(BUTTON_BLINKING, blinkingISR, HAL_RISING); // 깜박임모드 버튼 인터럽트 설정
+    halAttachInterrupt(BUTTON_TOGGLE, toggleISR, HAL_RISING); // ON/OFF 토글 버튼 인터럽트 설정
 
     // 시리얼 통신 시작
-    Serial.begin(9600);
-    Serial.println("Serial started");
+    halSerialBegin(SERIAL_BAUDRATE);
+    halSerialPrintln("Serial started");
+
+#if defined(TASK_TRACE) && !defined(_STATIC_SCHEDULER)
+    // enable/disable 기록
+    Task* tracedTasks[] = { &tNormal, &tBlinking, &tButtons, &tPeriodic, &tSerialTx };
+    for (size_t i = 0; i < sizeof(tracedTasks) / sizeof(tracedTasks[0]); i++) {
+        tracedTasks[i]->setOnEnable(&traceOnEnable);
+        tracedTasks[i]->setOnDisable(&traceOnDisable);
+    }
+#endif
 
-    // TaskScheduler 시작
+    // TaskScheduler 시작 (주기 Task는 생성 시점이 아닌 지금부터 일정 시작)
+    tPeriodic.enable();
+#ifdef _TASK_EDF
+    tSerialTx.reserve(); // 메시지가 들어올 때 enableIfNot()으로 켜므로 이용률을 미리 차지 (거부되면 송신 큐가 멈춤)
+#endif
+    txBegin(tSerialTx); // 송신 큐에 메시지가 들어오면 tSerialTx 시작
     setMode(NORMAL);
 }
 
 void loop() {
-    runner.execute(); // TaskScheduler 실행
+    controlDrain(); // ISR에서 들어온 Task 제어 명령 적용
+#ifdef SCHEDULER_STATS
+    unsigned long passStart = halMicros();
+#endif
+    bool idle = runner.execute(); // TaskScheduler 실행
+#ifdef TASK_TRACE
+    traceIdle(idle); // idle 진입 기록
+#endif
+#ifdef SCHEDULER_STATS
+    statsPass(idle, runner.getInvokedTasks(), passStart, halMicros()); // 구간 통계 누적
+#endif
+    (void)idle; // 통계와 trace를 모두 끄면 사용하지 않음
 }
\ No newline at end of file
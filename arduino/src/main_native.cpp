@@ -0,0 +1,230 @@
+#if !defined(ARDUINO) && !defined(PIO_UNIT_TESTING) // pio test에서는 테스트 파일(test/*/)이 자기 main()을 가짐
+
+// native 빌드 실행 진입점
+// - 실시간 모드: 표준 입력을 시리얼/버튼 입력으로 전달하며 실제 시간으로 실행
+// - 시뮬레이션 모드(--sim): _TASK_TICKLESS의 getNextRun() 값으로 가상 시계를
+//   다음 실행 시각까지 바로 이동 (idle pass를 돌지 않음)
+//
+// 사용 예: 24시간 중 앞 12시간은 NORMAL, 뒤 12시간은 BLINKING
+//   program --sim 24 --at 43200000 MODE:BLINKING --quiet
+// TASK_TRACE 빌드에서 --trace <파일>: 매 pass 후 trace 레코드를 파일에 기록 (TRACE:DUMP와 같은 형식)
+//   시뮬레이션 끝에 Task별 실행 횟수도 출력 (bench/run_wrap_soak.sh는 --trace /dev/null로 사용)
+// --start-ms <ms>: 가상 시계 시작 시각 (예: 4294900000 은 약 67초 후 32비트 millis 롤오버)
+//   --at 시각과 --sim 시간은 시작 시각 기준
+
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "hal.h"
+#include "trace.h"
+
+#ifdef _STATIC_SCHEDULER
+#include "static_scheduler.h" // getNextRun()을 항상 제공
+#else
+#include <TaskSchedulerDeclarations.h>
+
+#ifndef _TASK_TICKLESS
+#error "native 빌드는 _TASK_TICKLESS가 필요합니다 (platformio.ini 참고)"
+#endif
+#endif // _STATIC_SCHEDULER
+
+#define MAX_EVENTS 64 // --at 으로 지정할 수 있는 최대 이벤트 수
+
+void setup(); // main.cpp
+void loop(); // main.cpp
+extern Scheduler runner; // main.cpp
+#ifdef TASK_TRACE
+static FILE* traceFile = NULL; // --trace 출력 파일
+static unsigned long dispatchCounts[256]; // Task ID별 콜백 실행 횟수 (TRACE_START 수)
+
+// 쌓인 trace 레코드를 세고 파일로 옮기기
+static void flushTrace() {
+    if (traceFile == NULL) return; // --trace가 없으면 TRACE:DUMP용으로 남겨둠
+    TraceRecord record;
+    while (traceRead(record)) {
+        if (record.event == TRACE_START) dispatchCounts[record.task]++;
+        fprintf(traceFile, "TRACE:%lu,%u,%u,%u\n", (unsigned long)record.time, record.event, record.task, record.arg);
+    }
+}
+
+static void printDispatchCounts() {
+    fprintf(stderr, "dispatch:");
+    for (uint8_t i = 1; i < traceTaskCount; i++) fprintf(stderr, " %s=%lu", traceTaskNames[i], dispatchCounts[i]);
+    fprintf(stderr, "\n");
+}
+
+static bool openTrace(const char* path) {
+    traceFile = fopen(path, "w");
+    if (traceFile == NULL) return false;
+    for (uint8_t i = 1; i < traceTaskCount; i++) fprintf(traceFile, "TRACE:TASK,%u,%s\n", i, traceTaskNames[i]);
+    return true;
+}
+#endif // TASK_TRACE
+
+// 정해진 가상 시각에 전달할 입력
+struct SimEvent {
+    uint64_t time; // ms
+    const char* line;
+};
+
+static SimEvent events[MAX_EVENTS];
+static int eventCount = 0;
+
+// 입력 한 줄 처리
+// "!press <핀>" : 버튼 인터럽트, "!pot <값>" : 가변저항 값, 그 외 : 시리얼 수신
+static void handleInputLine(const char* line) {
+    int value;
+    if (sscanf(line, "!press %d", &value) == 1) {
+        halNativeTrigger((uint8_t)value);
+    } else if (sscanf(line, "!pot %d", &value) == 1) {
+        halNativeSetAnalog(A0, value);
+    } else if (line[0] != '\0' && line[0] != '!') {
+        halNativeSerialInject(line);
+        if (line[strlen(line) - 1] != '\n') halNativeSerialInject("\n");
+    }
+}
+
+// 표준 입력 확인, 입력이 없으면 최대 timeoutMs 동안 대기
+static bool pollInput(int timeoutMs) {
+    static char line[128];
+    static size_t length = 0;
+
+    struct pollfd fd = { STDIN_FILENO, POLLIN, 0 };
+    if (poll(&fd, 1, timeoutMs) <= 0) return true;
+
+    char data[64];
+    ssize_t count = read(STDIN_FILENO, data, sizeof(data));
+    if (count <= 0) return false; // EOF
+
+    for (ssize_t i = 0; i < count; i++) {
+        if (length < sizeof(line) - 1) line[length++] = data[i];
+        if (data[i] == '\n') {
+            line[length] = '\0';
+            handleInputLine(line);
+            length = 0;
+        }
+    }
+    return true;
+}
+
+// 다음 pass까지 기다릴 시간 (ms)
+static unsigned long nextPassDelay() {
+    if (runner.getInvokedTasks() > 0) return 0; // 실행된 Task가 있으면 바로 다시 확인
+    unsigned long next = runner.getNextRun();
+    return next > 0 ? next : 1; // 다음 실행 시각을 모르면 1ms 후
+}
+
+static void runRealtime() {
+    halNativeStartClock();
+    setup();
+
+    bool inputOpen = true;
+    for (;;) {
+        loop();
+#ifdef TASK_TRACE
+        flushTrace();
+        if (traceFile) fflush(traceFile); // 실시간 모드는 종료 시점이 없으므로 바로 기록
+#endif
+        unsigned long wait = nextPassDelay();
+        if (inputOpen) inputOpen = pollInput((int)wait); // 다음 실행 시각까지 입력 대기
+        else usleep(wait * 1000);
+    }
+}
+
+static void runSimulation(uint64_t startMs, uint64_t endMs) {
+    halNativeUseVirtualClock(startMs * 1000);
+    setup();
+
+    struct timespec wallStart, wallEnd;
+    clock_gettime(CLOCK_MONOTONIC, &wallStart);
+
+    unsigned long passes = 0;
+    int nextEvent = 0;
+    for (;;) {
+        uint64_t now = halNativeClockMicros() / 1000 - startMs; // 시작 시각 기준
+        while (nextEvent < eventCount && events[nextEvent].time <= now) {
+            handleInputLine(events[nextEvent++].line);
+        }
+        if (now >= endMs) break;
+
+        loop();
+        passes++;
+#ifdef TASK_TRACE
+        flushTrace();
+#endif
+
+        // 다음 실행 시각으로 이동 (예정된 입력이나 종료 시각을 넘지 않게)
+        uint64_t target = now + nextPassDelay();
+        if (nextEvent < eventCount && events[nextEvent].time < target) target = events[nextEvent].time;
+        if (target > endMs) target = endMs;
+        halNativeAdvanceClock((target - now) * 1000);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &wallEnd);
+    double wallMs = (wallEnd.tv_sec - wallStart.tv_sec) * 1000.0 + (wallEnd.tv_nsec - wallStart.tv_nsec) / 1e6;
+    fprintf(stderr, "sim: %llu ms virtual, %lu passes, %lu serial lines, %.1f ms wall\n",
+            (unsigned long long)endMs, passes, halNativeSerialLines(), wallMs);
+}
+
+// --at 이벤트를 시각 순으로 정렬 (같은 시각은 입력 순서 유지)
+static void sortEvents() {
+    for (int i = 1; i < eventCount; i++) {
+        SimEvent e = events[i];
+        int j = i - 1;
+        while (j >= 0 && events[j].time > e.time) {
+            events[j + 1] = events[j];
+            j--;
+        }
+        events[j + 1] = e;
+    }
+}
+
+int main(int argc, char** argv) {
+    double simHours = 0;
+    uint64_t startMs = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sim") == 0 && i + 1 < argc) {
+            simHours = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--start-ms") == 0 && i + 1 < argc) {
+            startMs = strtoull(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--at") == 0 && i + 2 < argc && eventCount < MAX_EVENTS) {
+            events[eventCount].time = strtoull(argv[i + 1], NULL, 10);
+            events[eventCount].line = argv[i + 2];
+            eventCount++;
+            i += 2;
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            halNativeSerialEcho(false);
+#ifdef TASK_TRACE
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            if (!openTrace(argv[++i])) {
+                perror(argv[i]);
+                return 1;
+            }
+#endif
+        } else {
+            fprintf(stderr, "usage: %s [--sim <hours>] [--at <ms> <input>]... [--start-ms <ms>] [--quiet] [--trace <file>]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (simHours > 0) {
+        sortEvents();
+        runSimulation(startMs, (uint64_t)(simHours * 3600000.0));
+#ifdef TASK_TRACE
+        if (traceFile) {
+            printDispatchCounts();
+            fprintf(stderr, "trace: %lu records lost\n", traceLost());
+            fclose(traceFile);
+        }
+#endif
+    } else {
+        runRealtime();
+    }
+    return 0;
+}
+
+#endif // !ARDUINO && !PIO_UNIT_TESTING
@@ -0,0 +1,65 @@
+#ifdef SCHEDULER_STATS
+
+#include "scheduler_stats.h"
+#include "hal.h"
+
+static SchedulerStats current; // 진행 중인 구간
+static SchedulerStats last; // 마지막으로 끝난 구간
+static unsigned long windowStart = 0; // 진행 중인 구간의 시작 시각 (us)
+static bool started = false;
+
+void statsPass(bool idle, unsigned long invokedTasks, unsigned long start, unsigned long end) {
+    if (!started) {
+        windowStart = start;
+        started = true;
+    }
+
+    unsigned long passMicros = end - start;
+    current.passes++;
+    if (idle) current.idlePasses++;
+    else current.busyMicros += passMicros;
+    current.invokedTasks += invokedTasks;
+    if (passMicros > current.maxPassMicros) current.maxPassMicros = passMicros;
+
+    unsigned long window = end - windowStart; // 롤오버에 안전한 차이
+    if (window >= STATS_WINDOW_MICROS) {
+        current.windowMicros = window;
+        last = current;
+        current = SchedulerStats();
+        windowStart = end;
+    }
+}
+
+const SchedulerStats& statsLast() {
+    return last;
+}
+
+// 구간 길이(us) 기준 초당 횟수
+static unsigned long perSecond(unsigned long count, unsigned long windowMicros) {
+    unsigned long windowMillis = windowMicros / 1000;
+    return windowMillis ? count * 1000UL / windowMillis : 0;
+}
+
+// 0.1% 단위로 출력 (예: 509 -> "50.9%")
+static void printPermille(unsigned long permille) {
+    halSerialPrint(permille / 10);
+    halSerialPrint(".");
+    halSerialPrint(permille % 10);
+    halSerialPrint("%");
+}
+
+void statsPrint() {
+    halSerialPrint("STATS:pass/s=");
+    halSerialPrint(perSecond(last.passes, last.windowMicros));
+    halSerialPrint(" idle=");
+    printPermille(last.passes ? last.idlePasses * 1000UL / last.passes : 0);
+    halSerialPrint(" task/s=");
+    halSerialPrint(perSecond(last.invokedTasks, last.windowMicros));
+    halSerialPrint(" maxpass=");
+    halSerialPrint(last.maxPassMicros);
+    halSerialPrint("us load=");
+    printPermille(last.windowMicros >= 1000 ? last.busyMicros / (last.windowMicros / 1000) : 0);
+    halSerialPrintln("");
+}
+
+#endif // SCHEDULER_STATS
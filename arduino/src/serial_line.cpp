@@ -0,0 +1,27 @@
+#include "serial_line.h"
+#include "hal.h"
+
+static char lineBuffer[SERIAL_LINE_SIZE]; // 모으는 중인 줄
+static uint8_t lineLength = 0;
+static bool lineOverflow = false; // 현재 줄이 버퍼보다 길어서 개행까지 버리는 중
+
+bool serialLineRead(char*& line) {
+    int c;
+    while ((c = halSerialRead()) >= 0) { // 수신 버퍼가 비면 바로 반환
+        if (c == '\n') {
+            bool complete = !lineOverflow;
+            lineBuffer[lineLength] = '\0';
+            lineLength = 0;
+            lineOverflow = false;
+            if (complete) {
+                line = lineBuffer;
+                return true;
+            }
+        } else if (lineLength < SERIAL_LINE_SIZE - 1) {
+            lineBuffer[lineLength++] = (char)c;
+        } else {
+            lineOverflow = true;
+        }
+    }
+    return false;
+}
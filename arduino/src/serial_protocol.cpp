@@ -0,0 +1,218 @@
+#include <string.h>
+
+#include "serial_protocol.h"
+#include "frame_codec.h"
+#include "serial_line.h"
+#include "serial_tx.h"
+#include "hal.h"
+
+static bool binaryMode = false; // PROTO:BIN 이후 true
+
+// Mode 값 순서 (main.cpp)
+static const char* const modeNames[] = { "NORMAL", "EMERGENCY", "BLINKING", "OFF" };
+#define MODE_COUNT (sizeof(modeNames) / sizeof(modeNames[0]))
+
+// 켜진 LED 비트 -> 텍스트 메시지 (신호 시퀀스가 쓰지 않는 조합은 NULL)
+static const char* const lightsNames[] = {
+    "ALL_LEDs_OFF", "RED", "YELLOW", NULL, "GREEN", NULL, NULL, "BLINKING_ALL_ON"
+};
+
+// LED 비트 하나 -> 이름 (신호 시간 명령과 같은 이름)
+static const char* lightName(uint8_t light) {
+    switch (light) {
+        case PROTOCOL_RED: return "RED";
+        case PROTOCOL_YELLOW: return "YELLOW";
+        case PROTOCOL_GREEN: return "GREEN";
+        default: return NULL;
+    }
+}
+
+// 버퍼 뒤에 문자열 추가 (넘치는 부분은 버림)
+static void appendText(char* buffer, size_t size, size_t& index, const char* text) {
+    while (*text && index < size - 1) buffer[index++] = *text++;
+    buffer[index] = '\0';
+}
+
+static void appendUnsigned(char* buffer, size_t size, size_t& index, unsigned long value) {
+    char digits[11];
+    uint8_t count = 0;
+    do {
+        digits[count++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (count > 0 && index < size - 1) buffer[index++] = digits[--count];
+    buffer[index] = '\0';
+}
+
+static void push(uint8_t opcode, uint8_t light, unsigned long value, const char* text) {
+    TxMessage message = { opcode, binaryMode, light, value, text };
+    txPush(message);
+}
+
+void protocolSendLights(uint8_t lights) {
+    push(PROTOCOL_LIGHTS, lights, 0, NULL);
+}
+
+void protocolSendMode(uint8_t mode) {
+    if (mode < MODE_COUNT) push(PROTOCOL_MODE, mode, 0, NULL);
+}
+
+void protocolSendBrightness(uint8_t brightness) {
+    txPushBrightness(brightness); // 보내기 전에 새 값이 오면 덮어씀
+}
+
+void protocolSendDuration(uint8_t light, unsigned long duration) {
+    if (lightName(light) != NULL) push(PROTOCOL_DURATION, light, duration, NULL);
+}
+
+void protocolSendText(const char* text) {
+    push(PROTOCOL_TEXT, 0, 0, text);
+}
+
+// 텍스트 프로토콜의 한 줄 (개행 제외), 보낼 것이 없으면 0
+static size_t formatLine(const TxMessage& message, char* line) {
+    size_t index = 0;
+    line[0] = '\0';
+    switch (message.opcode) {
+        case PROTOCOL_LIGHTS:
+            if (message.light < sizeof(lightsNames) / sizeof(lightsNames[0]) && lightsNames[message.light] != NULL) {
+                appendText(line, PROTOCOL_MESSAGE_SIZE, index, lightsNames[message.light]);
+            }
+            break;
+        case PROTOCOL_MODE:
+            appendText(line, PROTOCOL_MESSAGE_SIZE, index, "MODE:");
+            appendText(line, PROTOCOL_MESSAGE_SIZE, index, modeNames[message.light]);
+            break;
+        case PROTOCOL_BRIGHTNESS:
+            appendText(line, PROTOCOL_MESSAGE_SIZE, index, "Brightness: ");
+            appendUnsigned(line, PROTOCOL_MESSAGE_SIZE, index, message.light);
+            break;
+        case PROTOCOL_DURATION:
+            appendText(line, PROTOCOL_MESSAGE_SIZE, index, lightName(message.light));
+            appendText(line, PROTOCOL_MESSAGE_SIZE, index, "_DURATION:");
+            appendUnsigned(line, PROTOCOL_MESSAGE_SIZE, index, message.value);
+            break;
+        case PROTOCOL_TEXT:
+            appendText(line, PROTOCOL_MESSAGE_SIZE, index, message.text);
+            break;
+    }
+    return index;
+}
+
+// 바이너리 메시지 (opcode 포함)
+static size_t formatMessage(const TxMessage& message, uint8_t* data) {
+    size_t length = 0;
+    data[length++] = message.opcode;
+    if (message.opcode == PROTOCOL_TEXT) {
+        for (const char* text = message.text; *text && length < PROTOCOL_MESSAGE_SIZE; text++) data[length++] = (uint8_t)*text;
+        return length;
+    }
+    data[length++] = message.light;
+    if (message.opcode == PROTOCOL_DURATION) {
+        data[length++] = (uint8_t)message.value;
+        data[length++] = (uint8_t)(message.value >> 8);
+        data[length++] = (uint8_t)(message.value >> 16);
+        data[length++] = (uint8_t)(message.value >> 24);
+    }
+    return length;
+}
+
+unsigned int protocolDrain() {
+    int writable = halSerialWritable();
+    const TxMessage* message;
+    while ((message = txPeek()) != NULL) {
+        bool binary = message->binary;
+        if (message->opcode == PROTOCOL_BRIGHTNESS) {
+            // 송신 버퍼가 비었을 때만 보내서 뒤에 오는 상태 변경이 밝기 뒤에서 기다리지 않게 함
+            if (writable < HAL_SERIAL_TX_SIZE - 1) return HAL_SERIAL_TX_SIZE - 1 - writable;
+            binary = binaryMode; // 마지막 값만 남으므로 보내는 시점의 프로토콜을 따름
+        }
+        if (binary) {
+            uint8_t data[PROTOCOL_MESSAGE_SIZE];
+            uint8_t frame[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+            size_t length = frameEncode(data, formatMessage(*message, data), frame);
+            if ((int)length > writable) return (unsigned int)(length - writable); // 송신 버퍼에 자리가 날 때까지 대기
+            halSerialWrite(frame, length);
+            writable -= (int)length;
+        } else {
+            char line[PROTOCOL_MESSAGE_SIZE];
+            size_t length = formatLine(*message, line);
+            if (length > 0) {
+                if ((int)length + 2 > writable) return (unsigned int)(length + 2 - writable); // 개행 "\r\n" 포함
+                halSerialPrintln(line);
+                writable -= (int)length + 2;
+            }
+        }
+        txPop();
+    }
+    return 0;
+}
+
+void protocolSetBinary(bool binary) {
+    protocolSendText(binary ? "PROTO:BIN" : "PROTO:TEXT"); // 바꾸기 전의 프로토콜로 답함 (큐에 넣을 때의 프로토콜로 송신)
+    binaryMode = binary;
+}
+
+bool protocolBinary() {
+    return binaryMode;
+}
+
+// 바이너리 수신 상태
+static uint8_t frameBuffer[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE) - 1]; // 모으는 중인 프레임 (0x00 제외)
+static uint8_t frameLength = 0;
+static bool frameOverflow = false; // 프레임이 버퍼보다 길어서 0x00까지 버리는 중
+static uint8_t message[sizeof(frameBuffer)]; // 푼 메시지
+static char commandLine[SERIAL_LINE_SIZE]; // 메시지를 바꾼 명령 줄
+
+// 호스트 메시지를 텍스트 명령 줄로 변환, 모르는 메시지면 false
+static bool toCommandLine(const uint8_t* data, size_t length) {
+    if (!protocolMessageValid(data, length)) return false;
+    size_t index = 0;
+    switch (data[0]) {
+        case PROTOCOL_SET_MODE:
+            if (data[1] >= MODE_COUNT) return false;
+            appendText(commandLine, SERIAL_LINE_SIZE, index, "MODE:");
+            appendText(commandLine, SERIAL_LINE_SIZE, index, modeNames[data[1]]);
+            return true;
+        case PROTOCOL_SET_DURATION: {
+            const char* name = lightName(data[1]);
+            if (name == NULL) return false;
+            unsigned long duration = (unsigned long)data[2] | (unsigned long)data[3] << 8 |
+                                     (unsigned long)data[4] << 16 | (unsigned long)data[5] << 24;
+            appendText(commandLine, SERIAL_LINE_SIZE, index, name);
+            appendText(commandLine, SERIAL_LINE_SIZE, index, ":");
+            appendUnsigned(commandLine, SERIAL_LINE_SIZE, index, duration);
+            return true;
+        }
+        case PROTOCOL_COMMAND:
+            for (size_t i = 1; i < length && index < SERIAL_LINE_SIZE - 1; i++) commandLine[index++] = (char)data[i];
+            commandLine[index] = '\0';
+            return true;
+        default:
+            return false;
+    }
+}
+
+// 도착한 바이트만 모아 0x00으로 끝난 프레임을 처리 (CRC 오류 등 잘못된 프레임은 버림)
+static bool frameRead(char*& line) {
+    int c;
+    while ((c = halSerialRead()) >= 0) { // 수신 버퍼가 비면 바로 반환
+        if (c != 0) {
+            if (frameLength < sizeof(frameBuffer)) frameBuffer[frameLength++] = (uint8_t)c;
+            else frameOverflow = true;
+            continue;
+        }
+        size_t length = frameOverflow ? 0 : frameDecode(frameBuffer, frameLength, message);
+        frameLength = 0;
+        frameOverflow = false;
+        if (length > 0 && toCommandLine(message, length)) {
+            line = commandLine;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool protocolRead(char*& line) {
+    return binaryMode ? frameRead(line) : serialLineRead(line);
+}
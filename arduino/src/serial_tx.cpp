@@ -0,0 +1,79 @@
+#include "serial_tx.h"
+#include "serial_protocol.h"
+#include "hal.h"
+
+#if (TX_QUEUE_SIZE & (TX_QUEUE_SIZE - 1)) != 0 || TX_QUEUE_SIZE > 128
+#error "TX_QUEUE_SIZE는 128 이하의 2의 거듭제곱이어야 합니다"
+#endif
+
+static TxMessage queue[TX_QUEUE_SIZE]; // 상태 변경 메시지 (FIFO)
+static uint8_t queueHead = 0; // 다음에 넣을 위치 (TX_QUEUE_SIZE로 나눈 나머지)
+static uint8_t queueTail = 0; // 다음에 꺼낼 위치
+static TxMessage brightnessMessage = { PROTOCOL_BRIGHTNESS, false, 0, 0, NULL };
+static bool brightnessPending = false; // 보낼 밝기가 있음
+static TxStats stats;
+static Task* drainTask = NULL;
+
+static void updateDepth() {
+    stats.depth = (uint8_t)(queueHead - queueTail) + (brightnessPending ? 1 : 0);
+    if (stats.depth > stats.maxDepth) stats.maxDepth = stats.depth;
+}
+
+// 송신 Task 시작, now: 이미 실행 중이면 미뤄 둔 다음 실행을 바로 당김
+static void wake(bool now) {
+    if (drainTask == NULL) return;
+    if (drainTask->enableIfNot() && now) drainTask->forceNextIteration();
+}
+
+void txBegin(Task& task) {
+    drainTask = &task;
+    if (txPeek() != NULL) wake(false);
+}
+
+bool txPush(const TxMessage& message) {
+    if ((uint8_t)(queueHead - queueTail) >= TX_QUEUE_SIZE) {
+        stats.dropped++;
+        return false;
+    }
+    bool afterBrightness = queueHead == queueTail && brightnessPending; // 송신 Task가 밝기 때문에 송신 버퍼가 비길 기다리는 중
+    queue[queueHead % TX_QUEUE_SIZE] = message;
+    queueHead++;
+    updateDepth();
+    wake(afterBrightness);
+    return true;
+}
+
+void txPushBrightness(uint8_t brightness) {
+    if (brightnessPending) stats.coalesced++;
+    brightnessMessage.light = brightness;
+    brightnessPending = true;
+    updateDepth();
+    wake(false);
+}
+
+const TxMessage* txPeek() {
+    if (queueHead != queueTail) return &queue[queueTail % TX_QUEUE_SIZE];
+    if (brightnessPending) return &brightnessMessage;
+    return NULL;
+}
+
+void txPop() {
+    if (queueHead != queueTail) queueTail++;
+    else brightnessPending = false;
+    updateDepth();
+}
+
+const TxStats& txStats() {
+    return stats;
+}
+
+void txPrint() {
+    halSerialPrint("TXQ:depth=");
+    halSerialPrint((unsigned long)stats.depth);
+    halSerialPrint(" max=");
+    halSerialPrint((unsigned long)stats.maxDepth);
+    halSerialPrint(" dropped=");
+    halSerialPrint(stats.dropped);
+    halSerialPrint(" coalesced=");
+    halSerialPrintln(stats.coalesced);
+}
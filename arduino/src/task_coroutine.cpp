@@ -0,0 +1,38 @@
+#ifdef TASK_COROUTINE
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "task_coroutine.h"
+
+// 코루틴 프레임 풀 (고정 크기 슬롯)
+alignas(max_align_t) static unsigned char frames[COROUTINE_FRAME_COUNT][COROUTINE_FRAME_SIZE];
+static bool frameUsed[COROUTINE_FRAME_COUNT];
+
+void* coroutineFrameAlloc(size_t size) {
+    if (size > COROUTINE_FRAME_SIZE) {
+        fprintf(stderr, "coroutine frame %zu bytes > COROUTINE_FRAME_SIZE %d\n", size, COROUTINE_FRAME_SIZE);
+        abort();
+    }
+    for (int i = 0; i < COROUTINE_FRAME_COUNT; i++) {
+        if (!frameUsed[i]) {
+            frameUsed[i] = true;
+            return frames[i];
+        }
+    }
+    fprintf(stderr, "coroutine frame pool exhausted (COROUTINE_FRAME_COUNT %d)\n", COROUTINE_FRAME_COUNT);
+    abort();
+}
+
+void coroutineUnhandledException() {
+    fprintf(stderr, "unhandled exception in task coroutine\n");
+    abort();
+}
+
+void coroutineFrameFree(void* frame) {
+    for (int i = 0; i < COROUTINE_FRAME_COUNT; i++) {
+        if (frame == frames[i]) frameUsed[i] = false;
+    }
+}
+
+#endif // TASK_COROUTINE
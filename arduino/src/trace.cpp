@@ -0,0 +1,44 @@
+#ifdef TASK_TRACE
+
+#include "trace.h"
+
+TraceRecord traceBuffer[TRACE_BUFFER_SIZE];
+uint16_t traceHead = 0;
+uint16_t traceTail = 0;
+unsigned long traceLostRecords = 0;
+
+bool traceRead(TraceRecord& record) {
+    if (traceHead == traceTail) return false;
+    record = traceBuffer[traceTail & (TRACE_BUFFER_SIZE - 1)];
+    traceTail++;
+    return true;
+}
+
+unsigned long traceLost() {
+    return traceLostRecords;
+}
+
+void traceDump() {
+    for (uint8_t i = 1; i < traceTaskCount; i++) { // ID 0은 사용하지 않음
+        halSerialPrint("TRACE:TASK,");
+        halSerialPrint((long)i);
+        halSerialPrint(",");
+        halSerialPrintln(traceTaskNames[i]);
+    }
+
+    TraceRecord record;
+    while (traceRead(record)) {
+        halSerialPrint("TRACE:");
+        halSerialPrint((unsigned long)record.time);
+        halSerialPrint(",");
+        halSerialPrint((long)record.event);
+        halSerialPrint(",");
+        halSerialPrint((long)record.task);
+        halSerialPrint(",");
+        halSerialPrintln((long)record.arg);
+    }
+    halSerialPrint("TRACE:LOST,");
+    halSerialPrintln(traceLostRecords);
+}
+
+#endif // TASK_TRACE
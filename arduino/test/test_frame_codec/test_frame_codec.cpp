@@ -0,0 +1,131 @@
+// 바이너리 프레임(COBS + CRC-8) 단위 테스트 (pio test -e native)
+// 프로토콜이 보내는 메시지마다 프레임의 모든 비트를 하나씩 뒤집어,
+// 받는 쪽(frameDecode() + protocolMessageValid())이 모두 거부하는지 확인한다.
+
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "frame_codec.h"
+#include "serial_protocol.h"
+
+static uint8_t frame[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+static uint8_t corrupted[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+static uint8_t decoded[FRAME_SIZE(PROTOCOL_MESSAGE_SIZE)];
+
+void setUp() {}
+void tearDown() {}
+
+// 받는 쪽과 같은 처리: 0x00까지 모은 바이트를 풀고 opcode별 길이 확인
+static bool accepted(const uint8_t* bytes, size_t length) {
+    size_t end = 0;
+    while (end < length && bytes[end] != 0) end++; // 0x00이 된 바이트에서 프레임이 끝남
+    size_t decodedLength = frameDecode(bytes, end, decoded);
+    return decodedLength > 0 && protocolMessageValid(decoded, decodedLength);
+}
+
+static void checkMessage(const uint8_t* message, size_t length) {
+    size_t frameLength = frameEncode(message, length, frame) - 1; // 끝의 0x00 제외
+    TEST_ASSERT_TRUE(accepted(frame, frameLength));
+    TEST_ASSERT_EQUAL_MEMORY(message, decoded, length);
+
+    for (size_t i = 0; i < frameLength; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            memcpy(corrupted, frame, frameLength);
+            corrupted[i] ^= (uint8_t)(1 << bit);
+            if (accepted(corrupted, frameLength)) {
+                char reason[64];
+                snprintf(reason, sizeof(reason), "opcode 0x%02X, frame byte %u, bit %u", message[0], (unsigned)i, bit);
+                TEST_FAIL_MESSAGE(reason);
+            }
+        }
+    }
+}
+
+static void checkValue(uint8_t opcode, uint8_t value) {
+    uint8_t message[2] = { opcode, value };
+    checkMessage(message, sizeof(message));
+}
+
+static void checkDuration(uint8_t opcode, uint8_t light, unsigned long duration) {
+    uint8_t message[6] = { opcode, light, (uint8_t)duration, (uint8_t)(duration >> 8), (uint8_t)(duration >> 16),
+                           (uint8_t)(duration >> 24) };
+    checkMessage(message, sizeof(message));
+}
+
+static void checkText(uint8_t opcode, const char* text) {
+    uint8_t message[PROTOCOL_MESSAGE_SIZE];
+    size_t length = 0;
+    message[length++] = opcode;
+    while (*text && length < PROTOCOL_MESSAGE_SIZE) message[length++] = (uint8_t)*text++;
+    checkMessage(message, length);
+}
+
+// CRC가 0x00인 LIGHTS 메시지: 최종 XOR이 없으면 코드 바이트 오류로 {01}만 남아도 통과했음
+static void test_truncated_lights_rejected() {
+    const uint8_t message[] = { PROTOCOL_LIGHTS, PROTOCOL_RED | PROTOCOL_YELLOW | PROTOCOL_GREEN };
+    TEST_ASSERT_EQUAL_HEX8(0x00, frameCrc8(message, sizeof(message)));
+    checkMessage(message, sizeof(message));
+}
+
+// 1바이트 값 메시지는 모든 값
+static void test_value_messages_single_bit_flips_rejected() {
+    const uint8_t opcodes[] = { PROTOCOL_LIGHTS, PROTOCOL_MODE, PROTOCOL_BRIGHTNESS, PROTOCOL_SET_MODE };
+    for (size_t i = 0; i < sizeof(opcodes); i++) {
+        for (unsigned value = 0; value < 256; value++) checkValue(opcodes[i], (uint8_t)value);
+    }
+}
+
+// 신호 시간은 0x00 바이트가 많은 값과 의사 난수 값
+static void test_duration_messages_single_bit_flips_rejected() {
+    const uint8_t opcodes[] = { PROTOCOL_DURATION, PROTOCOL_SET_DURATION };
+    const uint8_t lights[] = { PROTOCOL_RED, PROTOCOL_YELLOW, PROTOCOL_GREEN };
+    const unsigned long durations[] = { 0, 1, 166, 255, 256, 500, 2000, 3000, 30000, 65535, 65536, 0xFFFFFFFFUL };
+    for (size_t o = 0; o < sizeof(opcodes); o++) {
+        for (size_t l = 0; l < sizeof(lights); l++) {
+            for (size_t d = 0; d < sizeof(durations) / sizeof(durations[0]); d++) {
+                checkDuration(opcodes[o], lights[l], durations[d]);
+            }
+            unsigned long seed = 1;
+            for (int r = 0; r < 2000; r++) {
+                seed = seed * 1103515245UL + 12345UL;
+                unsigned long duration = (seed >> 8) & (r & 1 ? 0xFFFFUL : 0xFFFFFFUL); // 상위 바이트 0x00
+                checkDuration(opcodes[o], lights[l], duration);
+            }
+        }
+    }
+}
+
+// 장치가 보내는 문자열과 호스트가 보내는 명령
+static void test_text_messages_single_bit_flips_rejected() {
+    const char* const texts[] = {
+        "TASK_REJECTED", "INVALID_VALUE", "PROTO:BIN", "PROTO:TEXT", "Serial started",
+        "RED:30000", "RED:3000", "MODE:NORMAL", "HIST:ALL", "STATS:", "TXQ:", "TRACE:DUMP", "A"
+    };
+    for (size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+        checkText(PROTOCOL_TEXT, texts[i]);
+        checkText(PROTOCOL_COMMAND, texts[i]);
+    }
+}
+
+// 잘린 메시지와 모르는 opcode는 CRC가 맞아도 거부
+static void test_message_length_checked() {
+    const uint8_t shortDuration[] = { PROTOCOL_SET_DURATION, PROTOCOL_RED, 0xB8, 0x0B, 0x00 };
+    const uint8_t longMode[] = { PROTOCOL_SET_MODE, 0, 0 };
+    const uint8_t emptyCommand[] = { PROTOCOL_COMMAND };
+    const uint8_t unknown[] = { 0x7F, 0 };
+    TEST_ASSERT_FALSE(protocolMessageValid(shortDuration, sizeof(shortDuration)));
+    TEST_ASSERT_FALSE(protocolMessageValid(longMode, sizeof(longMode)));
+    TEST_ASSERT_FALSE(protocolMessageValid(emptyCommand, sizeof(emptyCommand)));
+    TEST_ASSERT_FALSE(protocolMessageValid(unknown, sizeof(unknown)));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_truncated_lights_rejected);
+    RUN_TEST(test_value_messages_single_bit_flips_rejected);
+    RUN_TEST(test_duration_messages_single_bit_flips_rejected);
+    RUN_TEST(test_text_messages_single_bit_flips_rejected);
+    RUN_TEST(test_message_length_checked);
+    return UNITY_END();
+}
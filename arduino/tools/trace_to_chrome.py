@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# TASK_TRACE 출력(TRACE:DUMP 시리얼 로그 또는 native --trace 파일)을 Chrome trace JSON으로 변환
+# 사용법: tools/trace_to_chrome.py [입력 파일] > trace.json
+#   chrome://tracing 또는 https://ui.perfetto.dev 에서 열기
+# 입력에서 TRACE: 로 시작하는 줄만 사용하므로 다른 시리얼 출력이 섞여 있어도 된다.
+
+import json
+import sys
+
+TRACE_START, TRACE_END, TRACE_ENABLE, TRACE_DISABLE, TRACE_SIGNAL, TRACE_IDLE = range(6)
+EVENT_NAMES = {TRACE_ENABLE: "enable", TRACE_DISABLE: "disable", TRACE_SIGNAL: "signal", TRACE_IDLE: "idle"}
+NO_TASK = 0xFF
+
+
+def convert(lines):
+    names = {}
+    events = []
+    offset = 0  # 32비트 us 시각 롤오버 보정
+    previous = None
+    for line in lines:
+        start = line.find("TRACE:")
+        if start < 0:
+            continue
+        fields = line[start + len("TRACE:"):].strip().split(",")
+        if fields[0] == "TASK" and len(fields) >= 3:
+            names[int(fields[1])] = fields[2]
+            continue
+        if fields[0] == "LOST" or len(fields) != 4:
+            continue
+
+        time, event, task, arg = (int(value) for value in fields)
+        if previous is not None and time < previous and previous - time > 1 << 31:
+            offset += 1 << 32
+        previous = time
+        timestamp = time + offset
+
+        name = names.get(task, "scheduler" if task == NO_TASK else "task%d" % task)
+        if event == TRACE_START:
+            events.append({"name": name, "ph": "B", "ts": timestamp, "pid": 1, "tid": 1})
+        elif event == TRACE_END:
+            events.append({"name": name, "ph": "E", "ts": timestamp, "pid": 1, "tid": 1})
+        else:
+            events.append({"name": "%s %s" % (EVENT_NAMES.get(event, "event%d" % event), name), "ph": "i",
+                           "s": "t", "ts": timestamp, "pid": 1, "tid": 1, "args": {"arg": arg}})
+
+    # 링 버퍼 앞부분이 덮어써져 짝이 없는 END는 버림
+    depth = 0
+    paired = []
+    for event in events:
+        if event["ph"] == "E":
+            if depth == 0:
+                continue
+            depth -= 1
+        elif event["ph"] == "B":
+            depth += 1
+        paired.append(event)
+
+    metadata = [{"name": "thread_name", "ph": "M", "pid": 1, "tid": 1, "args": {"name": "scheduler"}}]
+    return {"traceEvents": metadata + paired, "displayTimeUnit": "ms"}
+
+
+def main():
+    source = open(sys.argv[1], errors="replace") if len(sys.argv) > 1 else sys.stdin
+    json.dump(convert(source), sys.stdout)
+    sys.stdout.write("\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,6 @@
 let port; // 시리얼 포트 객체
 let connectBtn; // 연결 버튼
+let protocolBtn; // 텍스트/바이너리 프로토콜 전환 버튼
 let redSlider, yellowSlider, greenSlider; // 슬라이더
 let mode = "NORMAL"; // 현재 모드
 let brightness = 0; // 밝기
@@ -10,6 +11,22 @@ let redState = false; // 각 신호등의 상태
 let yellowState = false;
 let greenState = false;
 let messageLog = []; // 시리얼 메시지 로그
+let binaryMode = false; // 바이너리 프레임 사용 여부 (아두이노가 PROTO:BIN으로 답한 뒤 true)
+
+// 바이너리 프로토콜 (arduino/include/serial_protocol.h, frame_codec.h와 같은 형식)
+// 프레임 = COBS(메시지 + (CRC-8 ^ FRAME_CRC_XOR)) + 0x00, 메시지의 첫 바이트가 opcode
+const FRAME_CRC_XOR = 0x55; // CRC 최종 XOR (잘린 프레임의 CRC가 우연히 맞지 않게 함)
+const PROTOCOL_LIGHTS = 0x01; // [켜진 LED 비트]
+const PROTOCOL_MODE = 0x02; // [모드]
+const PROTOCOL_BRIGHTNESS = 0x03; // [0~255]
+const PROTOCOL_DURATION = 0x04; // [LED 비트][ms, uint32 little endian]
+const PROTOCOL_TEXT = 0x05; // [ASCII]
+const PROTOCOL_SET_MODE = 0x81; // [모드]
+const PROTOCOL_SET_DURATION = 0x82; // [LED 비트][ms, uint32 little endian]
+const PROTOCOL_COMMAND = 0x83; // [ASCII 명령]
+const MODE_NAMES = ["NORMAL", "EMERGENCY", "BLINKING", "OFF"]; // 모드 값 순서
+const LIGHTS_NAMES = ["ALL_LEDs_OFF", "RED", "YELLOW", null, "GREEN", null, null, "BLINKING_ALL_ON"]; // 켜진 LED 비트 -> 텍스트 메시지
+const LIGHT_BITS = { RED: 0x01, YELLOW: 0x02, GREEN: 0x04 }; // LED 이름 -> 비트
 
 // 시리얼 포트 연결 및 UI 생성
 function setup() {
@@ -25,6 +42,11 @@ function createUI() {
   connectBtn.position(110, 440); // 위치 설정
   connectBtn.size(150, 40); // 크기 설정
   connectBtn.mousePressed(connectBtnClick); // 클릭 이벤트 설정
+
+  protocolBtn = createButton("Binary Protocol"); // 프로토콜 전환 버튼
+  protocolBtn.position(110, 490); // 위치 설정
+  protocolBtn.size(150, 40); // 크기 설정
+  protocolBtn.mousePressed(protocolBtnClick); // 클릭 이벤트 설정
   
   fill(255); // 텍스트 색상 설정
   textSize(16); // 텍스트 크기 설정
@@ -57,26 +79,63 @@ function draw() {
   } else {
     connectBtn.html("Disconnect");
   }
+  protocolBtn.html(binaryMode ? "Text Protocol" : "Binary Protocol"); // 전환할 프로토콜 표시
 }
 
 // 시리얼 메시지 확인
 function checkSerial() {
+  if (binaryMode) { // 바이너리 프레임 사용 중이면
+    checkFrames();
+    return;
+  }
   let n = port.available(); // 수신된 바이트 수
   if (n > 0) { // 수신된 바이트가 있으면
     let message = port.readUntil("\n"); // 메시지 읽기
     message = message.trim(); // 공백 제거
     if (message.length > 0) { // 메시지가 있으면
-      messageLog.unshift(message); // 메시지 로그에 추가
-      if (messageLog.length > 11) { // 메시지 로그가 11개 이상이면
-        messageLog.pop(); // 가장 오래된 메시지 삭제
-      }
+      logMessage(message); // 메시지 로그에 추가
       parseMessage(message); // 메시지 파싱
     }
   }
 }
 
+// 바이너리 프레임 확인 (0x00으로 끝난 프레임을 모두 처리)
+function checkFrames() {
+  while (binaryMode && port.availableBytes() > 0) {
+    let frame = port.readBytesUntil(0); // 프레임 읽기 (0x00 포함)
+    if (frame.length === 0) { // 프레임이 아직 다 오지 않았으면
+      break;
+    }
+    let message = frameDecode(frame.slice(0, -1));
+    if (message === null) { // CRC 오류 등 잘못된 프레임은 버림
+      continue;
+    }
+    let text = frameToText(message); // 텍스트 프로토콜의 같은 메시지로 변환
+    if (text !== null) {
+      logMessage(text); // 메시지 로그에 추가
+      parseMessage(text); // 메시지 파싱
+    }
+  }
+}
+
+// 메시지 로그에 추가
+function logMessage(message) {
+  messageLog.unshift(message); // 메시지 로그에 추가
+  if (messageLog.length > 11) { // 메시지 로그가 11개 이상이면
+    messageLog.pop(); // 가장 오래된 메시지 삭제
+  }
+}
+
 // 시리얼 메시지 파싱
 function parseMessage(message) { 
+  if (message === "PROTO:BIN") { // 바이너리 프레임으로 전환됨
+    binaryMode = true;
+    return;
+  }
+  if (message === "PROTO:TEXT") { // 텍스트로 전환됨
+    binaryMode = false;
+    return;
+  }
   if (message.startsWith("MODE:")) { // 메시지가 MODE:로 시작하면
     mode = message.substring(5);
     return;
@@ -191,24 +250,151 @@ function applyDurations() {
   if (port.opened()) { // 포트가 열려있으면
     if (redSlider.value() !== redDuration) { // 슬라이더 값이 변경되면
       redDuration = redSlider.value(); // 지속 시간 설정
-      port.write("RED:" + redSlider.value() + "\n"); // 메시지 전송
+      sendCommand("RED:" + redSlider.value()); // 메시지 전송
     }
     if (yellowSlider.value() !== yellowDuration) {
       yellowDuration = yellowSlider.value(); // 지속 시간 설정
-      port.write("YELLOW:" + yellowSlider.value() + "\n");
+      sendCommand("YELLOW:" + yellowSlider.value());
     }
     if (greenSlider.value() !== greenDuration) {
       greenDuration = greenSlider.value(); // 지속 시간 설정
-      port.write("GREEN:" + greenSlider.value() + "\n");
+      sendCommand("GREEN:" + greenSlider.value());
     }
   }
 }
 
 // 연결 버튼 클릭 이벤트
 function connectBtnClick() {
+  binaryMode = false; // 연결할 때마다 텍스트로 시작
   if (!port.opened()) {
     port.open(9600);
   } else {
     port.close();
   }
+}
+
+// 프로토콜 전환 버튼 클릭 이벤트 (아두이노가 응답하면 parseMessage()에서 전환)
+function protocolBtnClick() {
+  if (port.opened()) {
+    sendCommand(binaryMode ? "PROTO:TEXT" : "PROTO:BIN");
+  }
+}
+
+// 명령 전송 (텍스트: 한 줄, 바이너리: 같은 뜻의 프레임)
+function sendCommand(command) {
+  if (!binaryMode) {
+    port.write(command + "\n");
+    return;
+  }
+  let separator = command.indexOf(":");
+  let param = command.substring(0, separator);
+  let value = command.substring(separator + 1);
+  if (param === "MODE" && MODE_NAMES.includes(value)) {
+    port.write(frameEncode([PROTOCOL_SET_MODE, MODE_NAMES.indexOf(value)]));
+  } else if (param in LIGHT_BITS && /^[0-9]+$/.test(value) && Number(value) <= 0xFFFFFFFF) { // uint32에 들어가는 값만
+    let ms = Number(value);
+    port.write(frameEncode([PROTOCOL_SET_DURATION, LIGHT_BITS[param], ms & 0xff, (ms >>> 8) & 0xff, (ms >>> 16) & 0xff, (ms >>> 24) & 0xff]));
+  } else { // 그 밖의 명령은 문자열 그대로 (범위를 넘는 신호 시간도 아두이노가 텍스트와 같이 INVALID_VALUE로 거부)
+    let message = [PROTOCOL_COMMAND];
+    for (let i = 0; i < command.length; i++) {
+      message.push(command.charCodeAt(i) & 0xff);
+    }
+    port.write(frameEncode(message));
+  }
+}
+
+// CRC-8 (다항식 0x07, 초기값 0x00, 최종 XOR 전)
+function frameCrc8(bytes) {
+  let crc = 0;
+  for (let i = 0; i < bytes.length; i++) {
+    crc ^= bytes[i];
+    for (let bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? ((crc << 1) ^ 0x07) & 0xff : (crc << 1) & 0xff;
+    }
+  }
+  return crc;
+}
+
+// 메시지 -> 프레임 (COBS(메시지 + CRC) + 0x00)
+function frameEncode(message) {
+  let data = message.concat([frameCrc8(message) ^ FRAME_CRC_XOR]);
+  let out = [0]; // 첫 코드 바이트 자리
+  let codeIndex = 0;
+  let code = 1;
+  for (let i = 0; i < data.length; i++) {
+    if (data[i] === 0) {
+      out[codeIndex] = code;
+      codeIndex = out.length;
+      out.push(0);
+      code = 1;
+    } else {
+      out.push(data[i]);
+      code++;
+      if (code === 0xff) { // 0x00 없이 254바이트인 블록
+        out[codeIndex] = code;
+        codeIndex = out.length;
+        out.push(0);
+        code = 1;
+      }
+    }
+  }
+  out[codeIndex] = code;
+  out.push(0); // 프레임 끝
+  return out;
+}
+
+// 프레임(0x00 제외) -> 메시지, COBS 오류나 CRC 불일치면 null
+function frameDecode(frame) {
+  let data = [];
+  let index = 0;
+  while (index < frame.length) {
+    let code = frame[index++];
+    if (code === 0) {
+      return null;
+    }
+    for (let i = 1; i < code; i++) {
+      if (index >= frame.length || frame[index] === 0) { // 블록이 잘림
+        return null;
+      }
+      data.push(frame[index++]);
+    }
+    if (code < 0xff && index < frame.length) { // 블록 사이의 0x00
+      data.push(0);
+    }
+  }
+  if (data.length < 2) { // opcode와 CRC는 있어야 함
+    return null;
+  }
+  let message = data.slice(0, -1);
+  if ((frameCrc8(message) ^ FRAME_CRC_XOR) !== data[data.length - 1]) {
+    return null;
+  }
+  return message;
+}
+
+// opcode별 메시지 길이 (TEXT는 1자 이상), arduino/include/serial_protocol.h의 protocolMessageValid()와 같음
+const MESSAGE_LENGTHS = { [PROTOCOL_LIGHTS]: 2, [PROTOCOL_MODE]: 2, [PROTOCOL_BRIGHTNESS]: 2, [PROTOCOL_DURATION]: 6 };
+
+// 아두이노 메시지 -> 텍스트 프로토콜의 같은 메시지, 모르는 메시지나 길이가 맞지 않으면 null
+function frameToText(message) {
+  if (message[0] === PROTOCOL_TEXT ? message.length < 2 : message.length !== MESSAGE_LENGTHS[message[0]]) {
+    return null;
+  }
+  switch (message[0]) {
+    case PROTOCOL_LIGHTS:
+      return LIGHTS_NAMES[message[1]] || null;
+    case PROTOCOL_MODE:
+      return message[1] < MODE_NAMES.length ? "MODE:" + MODE_NAMES[message[1]] : null;
+    case PROTOCOL_BRIGHTNESS:
+      return "Brightness: " + message[1];
+    case PROTOCOL_DURATION: {
+      let name = Object.keys(LIGHT_BITS).find((key) => LIGHT_BITS[key] === message[1]);
+      let ms = (message[2] | (message[3] << 8) | (message[4] << 16) | (message[5] << 24)) >>> 0;
+      return name ? name + "_DURATION:" + ms : null;
+    }
+    case PROTOCOL_TEXT:
+      return String.fromCharCode(...message.slice(1));
+    default:
+      return null;
+  }
 }
\ No newline at end of file